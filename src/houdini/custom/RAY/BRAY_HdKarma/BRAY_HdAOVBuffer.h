@@ -71,11 +71,19 @@ public:
     void                UnmapExtra(int idx) override final;
     const UT_Options    &GetMetadata() const override final;
 
+    /// The version changes on every call while the render is in progress.
+    /// Once the buffer has converged, the version stays the same until the
+    /// render restarts or the buffer changes, so clients can skip mapping
+    /// and copying pixels they already have.
+    int64               GetDataVersion() const override final;
+
     bool		isValid() const { return myAOVBuffer.isValid(); }
     const BRAY::AOVBufferPtr	&aovBuffer() const { return myAOVBuffer; }
     void		setAOVBuffer(const BRAY::AOVBufferPtr &aov)
     {
 	myAOVBuffer = aov;
+	myDataVersion.exchangeAdd(1);
+	myResolvedConverged.exchange(0);
     }
 
 private:
@@ -84,6 +92,8 @@ private:
     BRAY::AOVBufferPtr		myAOVBuffer;
     UT_UniquePtr<uint8_t[]>	myTempbuf;
     SYS_AtomicInt32		myConverged;
+    mutable SYS_AtomicInt64	myDataVersion;
+    mutable SYS_AtomicInt32	myResolvedConverged;
     int				myWidth, myHeight;
     HdFormat			myFormat;
     bool			myMultiSampled;
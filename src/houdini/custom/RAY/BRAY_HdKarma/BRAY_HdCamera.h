@@ -54,6 +54,9 @@ public:
 			const GfVec2i &resolution,
 			bool lock_camera=true);
 
+    BRAY::CameraPtr &GetCameraPtr() { return myCamera; }
+    const BRAY::CameraPtr &GetCameraPtr() const { return myCamera; }
+
 private:
     BRAY::CameraPtr		myCamera;
 
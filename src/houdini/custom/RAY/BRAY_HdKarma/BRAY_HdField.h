@@ -35,6 +35,8 @@
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+class BRAY_HdParam;
+
 ///
 /// HdField represents an actual data of field that might not be 
 /// actually renderable.
@@ -52,6 +54,8 @@ public:
 				     HdRenderParam* renderParam,
 				     HdDirtyBits* dirtyBits) override;
 
+    virtual void		Finalize(HdRenderParam* renderParam) override;
+
     GT_PrimitiveHandle		getGTPrimitive() const
 				{ return myField; }
 
@@ -76,12 +80,14 @@ protected:
 
 private:
 
-    void			updateGTPrimitive();
+    void			updateGTPrimitive(BRAY_HdParam &rparm);
+    void			releaseGTPrimitive(BRAY_HdParam &rparm);
 
     GT_PrimitiveHandle		myField;
     TfToken			myFieldType;
     UT_StringHolder 		myFilePath;
     UT_StringHolder		myFieldName;
+    UT_StringHolder		myFieldKey;
     UT_SmallArray<GfMatrix4d>	myXfm;
     UT_StringSet		myVolumes;
     int				myFieldIdx;
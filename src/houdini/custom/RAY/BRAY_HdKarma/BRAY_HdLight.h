@@ -30,6 +30,7 @@
 #include <pxr/imaging/hd/enums.h>
 #include <pxr/base/gf/matrix4f.h>
 #include <BRAY/BRAY_Interface.h>
+#include <SYS/SYS_Hash.h>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -55,6 +56,7 @@ private:
     TfToken		myLightType;
     BRAY::LightPtr	myLight;
     SdfPath		myAreaLightGeometryPath;
+    SYS_HashType	myInputsHash;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
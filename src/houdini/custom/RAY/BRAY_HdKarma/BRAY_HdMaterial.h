@@ -30,7 +30,10 @@
 #include <pxr/imaging/hd/enums.h>
 #include <pxr/base/gf/matrix4f.h>
 
+#include <BRAY/BRAY_Interface.h>
 #include <UT/UT_StringArray.h>
+#include <UT/UT_StringMap.h>
+#include <string>
 
 class UT_JSONWriter;
 
@@ -59,11 +62,27 @@ public:
 private:
     void	setShaders(HdSceneDelegate *delegate);
     void	setParameters(HdSceneDelegate *delegate);
+    bool	updateNetwork(bool for_surface,
+			BRAY::ScenePtr &scene,
+			BRAY::MaterialPtr &bmat,
+			const UT_StringHolder &name,
+			const HdMaterialNetwork &net,
+			HdMaterialNetwork &prevnet,
+			UT_StringArray &prevcode,
+			UT_StringMap<std::string> &loaded,
+			HdSceneDelegate &delegate);
 
     UT_StringHolder	mySurfaceSource;
     UT_StringHolder	myDisplaceSource;
     UT_StringArray	mySurfaceParms;
     UT_StringArray	myDisplaceParms;
+    HdMaterialNetwork	mySurfaceNet;
+    HdMaterialNetwork	myDisplaceNet;
+    UT_StringArray	mySurfaceNetCode;
+    UT_StringArray	myDisplaceNetCode;
+    UT_StringMap<std::string>	mySurfaceCode;
+    UT_StringMap<std::string>	myDisplaceCode;
+    bool		myHasNetworks;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
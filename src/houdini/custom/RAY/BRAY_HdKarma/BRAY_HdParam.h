@@ -32,14 +32,21 @@
 #include <UT/UT_Set.h>
 #include <UT/UT_Lock.h>
 #include <UT/UT_Map.h>
+#include <UT/UT_StringMap.h>
 #include <UT/UT_UniquePtr.h>
+#include <GT/GT_AttributeList.h>
+#include <GT/GT_DataArray.h>
+#include <GT/GT_Handles.h>
+#include <GU/GU_DetailHandle.h>
 #include <BRAY/BRAY_Interface.h>
+#include <HUSD/HUSD_HydraSyncStats.h>
 #include <HUSD/XUSD_RenderSettings.h>
 
 class UT_JSONWriter;
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+class BRAY_HdCamera;
 class BRAY_HdInstancer;
 class BRAY_HdLight;
 
@@ -73,11 +80,86 @@ public:
     /// Return true if the render has been stopped for processing
     void	processQueuedInstancers();
 
+    /// @{
+    /// Light and camera syncs only gather their properties.  Committing the
+    /// options and sending the update event to the scene is queued here, so
+    /// the syncs can run concurrently and the scene is edited once per pass.
+    /// Events queued for the same prim are merged.  Prims which are
+    /// finalized must be removed from the queue.
+    void	queueLightUpdate(BRAY_HdLight *light,
+			BRAY_EventType event, bool commit);
+    void	queueCameraUpdate(BRAY_HdCamera *camera,
+			BRAY_EventType event, bool commit);
+    void	dequeueLight(BRAY_HdLight *light);
+    void	dequeueCamera(BRAY_HdCamera *camera);
+    /// @}
+
+    /// Commit the queued light and camera updates to the scene
+    void	processQueuedSprims();
+
+    /// Return an array with the same contents as @c data, sharing storage
+    /// with an identical array previously passed to this method if there
+    /// is one.  Small arrays are returned as is.
+    GT_DataArrayHandle	shareArray(const GT_DataArrayHandle &data);
+
+    /// Share the arrays of an attribute list that has a single motion
+    /// segment (using shareArray()).  The list is modified in place, so it
+    /// must not be shared by an existing primitive.
+    void		shareAttributes(const GT_AttributeListHandle &alist);
+
+    /// Release shared arrays which are no longer used by any primitive
+    void		purgeSharedArrays();
+
+    /// @{
+    /// Field primitives are shared by all the field prims which load the
+    /// same field from the same file, so instanced volumes only load and
+    /// convert each grid once.  The key is built by BRAY_HdField from the
+    /// file key, the field name and the field index.  The file key holds
+    /// the resolved file path along with the modification time of files on
+    /// disk, or the detail id and meta cache count of ticket geometry, so
+    /// fields are never shared with older versions of the same file.
+    /// findField() and storeField() add a
+    /// reference to the shared field, which must be released with
+    /// releaseField() when the prim no longer uses it or is finalized.
+    /// storeField() returns the field already stored by another thread if
+    /// there is one.
+    GT_PrimitiveHandle	findField(const UT_StringHolder &key);
+    GT_PrimitiveHandle	storeField(const UT_StringHolder &key,
+				const UT_StringHolder &filekey,
+				const GT_PrimitiveHandle &field);
+    void		releaseField(const UT_StringHolder &key);
+    /// @}
+
+    /// @{
+    /// The geometry loaded from a field file is kept while any field loaded
+    /// from it is still in use, so the other fields in the same file don't
+    /// load it again.  The geometry is looked up by its file key.
+    GU_DetailHandle	findFieldFile(const UT_StringHolder &filekey) const;
+    void		storeFieldFile(const UT_StringHolder &filekey,
+				const GU_DetailHandle &gdh);
+    /// @}
+
     /// Global list of light categories
     void	addLightCategory(const UT_StringHolder &name);
     bool	eraseLightCategory(const UT_StringHolder &name);
     bool	isValidLightCategory(const UT_StringHolder &name);
 
+    /// Add a shadow trace set to the scene
+    void	addTraceset(const UT_StringHolder &name);
+
+    /// @{
+    /// Objects often share the same list of categories (i.e. from light
+    /// linking collections).  The trace sets and light categories computed
+    /// for a list (keyed on the space separated category names) are cached
+    /// until the light categories or trace sets change.
+    bool	findCategories(const UT_StringHolder &key,
+			UT_StringHolder &tracesets,
+			UT_StringHolder &lightlink) const;
+    void	storeCategories(const UT_StringHolder &key,
+			const UT_StringHolder &tracesets,
+			const UT_StringHolder &lightlink);
+    /// @}
+
     void	dump() const;
     void	dump(UT_JSONWriter &w) const;
 
@@ -155,13 +237,38 @@ public:
 		}
     float	fps() const { return myFPS; }
 
+    /// Counters for the syncs of the prims in this render delegate
+    HUSD_HydraSyncStats	&syncStats() { return mySyncStats; }
+    const HUSD_HydraSyncStats	&syncStats() const { return mySyncStats; }
+
 private:
     exint	getQueueCount() const;
 
+    struct QueuedSprim
+    {
+	BRAY_EventType	myEvent = BRAY_NO_EVENT;
+	bool		myCommit = false;
+    };
+
+    struct SharedField
+    {
+	GT_PrimitiveHandle	myField;
+	UT_StringHolder		myFileKey;
+	exint			myRefCount = 0;
+    };
+
     using QueuedInstances = UT_Set<BRAY_HdInstancer *>;
+    using QueuedLights = UT_Map<BRAY_HdLight *, QueuedSprim>;
+    using QueuedCameras = UT_Map<BRAY_HdCamera *, QueuedSprim>;
+    using SharedArrays = UT_Map<SYS_HashType, UT_Array<GT_DataArrayHandle>>;
     UT_Array<QueuedInstances>    myQueuedInstancers;
+    SharedArrays                 mySharedArrays;
+    UT_Lock                      mySharedArrayLock;
     UT_StringHolder              myCameraPath;
     mutable                      UT_Lock myQueueLock;
+    QueuedLights                 myQueuedLights;
+    QueuedCameras                myQueuedCameras;
+    UT_Lock                      mySprimQueueLock;
     BRAY::ScenePtr               myScene;
     BRAY::RendererPtr           &myRenderer;
     HdRenderThread              &myThread;
@@ -176,7 +283,15 @@ private:
     ConformPolicy                myConformPolicy;
     bool                         myInstantShutter;
 
+    UT_StringMap<SharedField>    mySharedFields;
+    UT_StringMap<GU_DetailHandle> myFieldFiles;
+    mutable UT_Lock              myFieldLock;
+
     UT_Set<UT_StringHolder>      myLightCategories;
+    UT_StringMap<std::pair<UT_StringHolder, UT_StringHolder>>
+				 myCategoryCache;
+    mutable UT_Lock		 myCategoryLock;
+    HUSD_HydraSyncStats		 mySyncStats;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -149,6 +149,13 @@ public:
     /// Sum the values in an integer array
     static GT_Size	sumCounts(const GT_DataArrayHandle &counts);
 
+    /// Replace numeric arrays in the attribute list whose elements all have
+    /// the same value with a constant array storing a single element.  This
+    /// is lossless; the attribute names, sizes and types don't change.  "P"
+    /// is never replaced.  The list is modified in place, so it must not be
+    /// shared with an existing primitive.
+    static void		compactAttributes(const GT_AttributeListHandle &alist);
+
     /// @{
     /// Create a BRAY::SpacePtr for a given matrix.  This includes transforms
     /// for multiple segements of motion blur.  This is specialized for:
@@ -426,11 +433,6 @@ private:
 				int style,
 				int nseg,
 				const BRAY_HdParam &rparm);
-
-    static
-    GT_DataArrayHandle	    computeBlur(const GT_DataArrayHandle& Parr,
-				const fpreal32* P, const fpreal32* v,
-				const fpreal32* a, fpreal32 amount);
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
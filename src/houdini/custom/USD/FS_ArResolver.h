@@ -43,6 +43,7 @@
 #include <UT/UT_String.h>
 #include <UT/UT_StringHolder.h>
 #include <UT/UT_Lock.h>
+#include <UT/UT_RWLock.h>
 #include <UT/UT_ConcurrentHashMap.h>
 #include <UT/UT_ThreadSpecificValue.h>
 
@@ -132,6 +133,9 @@ private:
 				UT_String& realPath);
     void		 _EvalHoudini(const UT_String& source,
 				UT_String& realPath);
+    // Resolve a non-Houdini path with the fallback resolver, sharing the
+    // results between all threads until the next RefreshContext.
+    std::string		 _ResolveFallback(const std::string& path);
 
     // Types for the scoped identifier-to-resolvedPath map cache
     typedef UT_ConcurrentHashMap<UT_StringHolder, UT_StringHolder> PathMap;
@@ -176,9 +180,23 @@ private:
     typedef UT_IntrusivePtr<FetchItem> FetchPtr;
     typedef UT_ConcurrentHashMap<UT_StringHolder, FetchPtr> FetchMap;
 
+    // Types for the shared fallback resolve cache
+    struct ResolveEntry
+    {
+	UT_StringHolder	 myResolvedPath;
+	double		 myModTime;
+    };
+    typedef UT_ConcurrentHashMap<UT_StringHolder, ResolveEntry> ResolveMap;
+
     // Private members
     TLSCacheScopeDataArray	 myTLSCacheScopeDataArray;
     FetchMap			 myFetchMap;
+    // Process-wide cache of fallback resolves, keyed on the path and the
+    // bound context. Entries remember the modification time of the resolved
+    // file so a file that was replaced or removed is resolved again. The
+    // lock is only held for writing to clear the map.
+    ResolveMap			 myResolveCache;
+    UT_RWLock			 myResolveCacheLock;
     std::vector<std::string>	 mySearchPath;
     std::unique_ptr<ArResolver>	 myFallbackResolver;
 };
@@ -20,13 +20,18 @@
 #include "GEO_SceneDescriptionData.h"
 #include "GEO_FilePrim.h"
 #include <GU/GU_DetailHandle.h>
+#include <UT/UT_SharedPtr.h>
 #include <UT/UT_UniquePtr.h>
 #include <UT/UT_Array.h>
+#include <set>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
 TF_DECLARE_WEAK_AND_REF_PTRS(GEO_FileData);
 
+class GEO_FileDataContents;
+class GEO_FileSequence;
+
 /// \class GEO_FileData
 ///
 /// Provides an SdfAbstractData interface to Houdini geometry data.
@@ -45,13 +50,58 @@ public:
     /// store for editing so methods that modify the file are not supported.
     bool Open(const std::string &filePath) override;
 
+    // When opened with the "sequencestart" and "sequenceend" arguments, the
+    // layer represents a numbered file sequence. The opened file provides
+    // the layer's prims, and attribute values for each frame are loaded
+    // from the corresponding file when first requested.
+    std::set<double> ListAllTimeSamples() const override;
+    std::set<double> ListTimeSamplesForPath(
+        const SdfPath &id) const override;
+    bool GetBracketingTimeSamples(double time,
+                                  double *tLower,
+                                  double *tUpper) const override;
+    size_t GetNumTimeSamplesForPath(const SdfPath &id) const override;
+    bool GetBracketingTimeSamplesForPath(const SdfPath &id,
+                                         double time,
+                                         double *tLower,
+                                         double *tUpper) const override;
+    bool QueryTimeSample(const SdfPath &id,
+                         double time,
+                         SdfAbstractDataValue *value) const override;
+    bool QueryTimeSample(const SdfPath &id,
+                         double time,
+                         VtValue *value) const override;
+
 protected:
 			 GEO_FileData();
                         ~GEO_FileData() override;
 
 private:
+    /// Use prims from the shared contents of an already open file.
+    void adoptSharedContents(
+        const UT_SharedPtr<const GEO_FileDataContents> &contents);
+
+    /// Sets up sequence mode if requested by the file format arguments.
+    void initSequence(const std::string &filePath);
+
+    /// Returns whether the property has values for each frame of the
+    /// sequence.
+    bool isSequenceProperty(const SdfPath &id) const;
+
+    /// Returns the data for a frame of the sequence, loading it if required.
+    GEO_FileDataConstRefPtr getSequenceFrame(double frame) const;
+
+    template <typename T>
+    bool querySequenceSample(const SdfPath &id, double time,
+                             T *value) const;
+
+    // Keeps the source geometry alive while attribute conversions are
+    // deferred until the attribute values are requested.
+    GU_ConstDetailHandle		 myDeferredDetail;
     GEO_FilePrim			*myLayerInfoPrim;
     SdfFileFormat::FileFormatArguments	 myCookArgs;
+    UT_UniquePtr<GEO_FileSequence>	 mySequence;
+    int64				 myDetailMemory;
     bool				 mySaveSampleFrame;
 
     friend class GEO_FilePrim;
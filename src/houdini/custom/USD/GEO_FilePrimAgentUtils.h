@@ -23,6 +23,10 @@
 #include <GU/GU_AgentDefinition.h>
 #include <GU/GU_AgentRig.h>
 #include <GU/GU_DetailHandle.h>
+#include <UT/UT_CappedCache.h>
+#include <UT/UT_IntrusivePtr.h>
+#include <UT/UT_Map.h>
+#include <UT/UT_StringMap.h>
 #include <pxr/pxr.h>
 #include <pxr/base/vt/array.h>
 #include <pxr/base/vt/types.h>
@@ -101,11 +105,53 @@ struct GEO_AgentSkeleton
     UT_BitArray myMask;
 };
 
+/// The parts of the USD representation of an agent definition that only
+/// depend on its rig and shape library: the joint list, the USD paths of the
+/// shapes, and the skeletons required by the deforming shapes. Crowd caches
+/// written per frame usually share the same rig and shape library on every
+/// frame, so these are cached across all the files that are imported rather
+/// than being rebuilt for each file. Since each frame may load its own copy
+/// of the shape library, the shapes are identified by name rather than by
+/// their unique ids.
+class GEO_AgentRigData : public UT_CappedItem
+{
+public:
+    GEO_AgentRigData(const GU_AgentRig &rig, const GU_AgentShapeLib *shapelib);
+
+    int64 getMemoryUsage() const override;
+
+    /// Fills in the results of GEObuildUsdShapePath() for the shape ids of a
+    /// shape library with the same contents as the one this was built from.
+    void getShapePaths(const GU_AgentShapeLib &shapelib,
+                       UT_Map<exint, SdfPath> &shape_paths) const;
+
+    /// Joint names and order, as returned by GEObuildJointList().
+    VtTokenArray myJointPaths;
+    UT_Array<exint> myJointOrder;
+    /// The results of GEObuildUsdShapePath() for each shape name.
+    UT_StringMap<SdfPath> myShapePaths;
+    /// The skeletons needed by the deforming shapes, and the skeleton used by
+    /// each shape name. This is empty if there aren't any deforming shapes.
+    UT_Array<GEO_AgentSkeleton> mySkeletons;
+    UT_StringMap<exint> myShapeToSkeleton;
+};
+
+using GEO_AgentRigDataConstPtr = UT_IntrusivePtr<const GEO_AgentRigData>;
+
+/// Returns the shared data for a rig and shape library, building it if it
+/// isn't already cached. The data is keyed on the file that the rig or shape
+/// library was loaded from, or on a hash of their contents. If there is no
+/// shape library, only the joint list is filled in.
+GEO_AgentRigDataConstPtr GEOgetAgentRigData(const GU_AgentRig &rig,
+                                            const GU_AgentShapeLib *shapelib);
+
 /// Determine how many unique skeletons are needed for the shapes in the agent
 /// definition, and record which skeleton is needed for each shape id.
 /// In the case where there aren't any deforming shapes, the provided bind pose
-/// is used for the single skeleton prim.
+/// is used for the single skeleton prim. The skeletons are copied from
+/// rig_data, which must have been built for the definition.
 void GEObuildUsdSkeletons(const GU_AgentDefinition &defn,
+                          const GEO_AgentRigData &rig_data,
                           const GU_Agent::Matrix4Array &fallback_bind_pose,
                           UT_Array<GEO_AgentSkeleton> &skeletons,
                           UT_Map<exint, exint> &shape_to_skeleton);
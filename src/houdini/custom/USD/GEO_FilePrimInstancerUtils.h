@@ -20,12 +20,17 @@
 
 #include "GEO_Boost.h"
 #include "GEO_FileUtils.h"
+#include <UT/UT_Algorithm.h>
 #include <UT/UT_Map.h>
+#include <GA/GA_Types.h>
 #include <GT/GT_GEOPrimPacked.h>
 #include <GT/GT_Primitive.h>
+#include <GU/GU_AgentDefinition.h>
 #include <SYS/SYS_Hash.h>
+#include BOOST_HEADER(functional/hash.hpp)
 #include BOOST_HEADER(variant.hpp)
 #include <pxr/pxr.h>
+#include <pxr/base/tf/token.h>
 #include <pxr/base/vt/types.h>
 #include <pxr/usd/sdf/path.h>
 
@@ -83,6 +88,88 @@ extern const GT_PackedInstanceKey GTnotInstancedKey;
 GT_PackedInstanceKey
 GTpackedInstanceKey(const GT_GEOPrimPacked &prototype_prim);
 
+/// Identifies a refined prototype. Besides the instanced geometry, this
+/// includes the refiner settings that change how the geometry is refined,
+/// since packed primitives with different settings can't share a prototype.
+struct GEO_PrototypeKey
+{
+    GEO_PrototypeKey(const GT_PackedInstanceKey &instance_key,
+                     const TfToken &purpose, GA_DataId topology_id,
+                     uint32 write_ctrl_flags,
+                     const GU_AgentDefinitionConstPtr &agent_defn,
+                     const UT_StringHolder &agent_shape_name)
+        : myInstanceKey(instance_key)
+        , myPurpose(purpose)
+        , myTopologyId(topology_id)
+        , myWriteCtrlFlags(write_ctrl_flags)
+        , myAgentDefinition(agent_defn)
+        , myAgentShapeName(agent_shape_name)
+    {
+    }
+
+    bool operator==(const GEO_PrototypeKey &other) const
+    {
+        return myInstanceKey == other.myInstanceKey &&
+               myPurpose == other.myPurpose &&
+               myTopologyId == other.myTopologyId &&
+               myWriteCtrlFlags == other.myWriteCtrlFlags &&
+               myAgentDefinition == other.myAgentDefinition &&
+               myAgentShapeName == other.myAgentShapeName;
+    }
+
+    size_t hash() const
+    {
+        size_t hash_val = BOOST_NS::hash<GT_PackedInstanceKey>()(myInstanceKey);
+        SYShashCombine(hash_val, myPurpose.Hash());
+        SYShashCombine(hash_val, myTopologyId);
+        SYShashCombine(hash_val, myWriteCtrlFlags);
+        SYShashCombine(hash_val, myAgentDefinition.get());
+        SYShashCombine(hash_val, myAgentShapeName);
+        return hash_val;
+    }
+
+    /// For unordered_map.
+    friend size_t hash_value(const GEO_PrototypeKey &key)
+    {
+        return key.hash();
+    }
+
+    GT_PackedInstanceKey myInstanceKey;
+    TfToken myPurpose;
+    GA_DataId myTopologyId;
+    uint32 myWriteCtrlFlags;
+    GU_AgentDefinitionConstPtr myAgentDefinition;
+    UT_StringHolder myAgentShapeName;
+};
+
+/// Remembers the prototype prim that was refined for each instanced packed
+/// geometry in a layer. Every point instancer and native instance in the
+/// layer, including those refined from nested packed primitives, then shares
+/// a single copy of the prototype instead of refining the geometry again.
+class GEO_PrototypeRegistry
+{
+public:
+    /// Returns the path to the prototype for the key, or a null handle if
+    /// there isn't one yet.
+    GEO_PathHandle find(const GEO_PrototypeKey &key) const
+    {
+        auto it = myPrototypes.find(key);
+        return it != myPrototypes.end() ? it->second : GEO_PathHandle();
+    }
+
+    /// Returns the path to the prototype for the key, calling create_fn to
+    /// refine the prototype if it hasn't been seen before.
+    template <typename CREATE_FN>
+    GEO_PathHandle findOrCreate(const GEO_PrototypeKey &key,
+                                const CREATE_FN &create_fn)
+    {
+        return UTfindOrInsert(myPrototypes, key, create_fn);
+    }
+
+private:
+    UT_Map<GEO_PrototypeKey, GEO_PathHandle> myPrototypes;
+};
+
 /// GT equivalent to UsdGeomPointInstancer. Stores a set of references to the
 /// prototype primitives, along with the point data (prototype id, transform,
 /// attributes, etc).
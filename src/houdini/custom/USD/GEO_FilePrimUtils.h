@@ -86,6 +86,9 @@ public:
     bool                         myTranslateUVToST = true;
     bool                         mySetDefaultPrim = true;
     bool                         myHeightfieldConvert = false;
+    /// Convert attribute values when they are first requested rather than
+    /// while the layer is opened.
+    bool                         myDeferAttribConversion = false;
 };
 
 void 
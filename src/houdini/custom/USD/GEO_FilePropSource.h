@@ -20,7 +20,9 @@
 #include "pxr/pxr.h"
 #include "GEO_FileFieldValue.h"
 #include <GT/GT_DataArray.h>
+#include <SYS/SYS_AtomicInt.h>
 #include <UT/UT_IntrusivePtr.h>
+#include <UT/UT_Lock.h>
 #include <UT/UT_NonCopyable.h>
 #include <UT/UT_TBBSpinLock.h>
 #include <pxr/base/vt/array.h>
@@ -134,20 +136,23 @@ private:
     };
 
 public:
+    /// If \p defer is true, the attribute isn't converted to a contiguous
+    /// array until its value is first requested.
 			 GEO_FilePropAttribSource(
-				 const GT_DataArrayHandle &attrib)
+				 const GT_DataArrayHandle &attrib,
+				 bool defer = false)
 			     : myAttrib(attrib),
-			       myData(nullptr)
+			       myData(nullptr),
+			       myHasData(false)
 			 {
-			    GT_DataArrayHandle	 storage;
-                            myData = myAttrib->getArray<ComponentT>(storage);
-
-			    if (storage)
-				myAttrib = storage;
+			    if (!defer)
+				ensureData();
 			 }
 
     bool	         copyData(const GEO_FileFieldValue &value) override
 			 {
+			    ensureData();
+
                             // If our data source is being held in an array,
                             // hold a pointer to this object in the data
                             // source. When the last array releases the data
@@ -176,13 +181,46 @@ public:
 			 }
 
     GT_Size		 size() const
-			 { return myAttrib->entries(); }
+			 {
+			    // ensureData() may replace myAttrib with its
+			    // converted storage, so don't read it unlocked until
+			    // the conversion is done.
+			    if (myHasData.load())
+				return myAttrib->entries();
+
+			    UT_Lock::Scope lock(myDataLock);
+			    return myAttrib->entries();
+			 }
     const T		*data() const
-			 { return reinterpret_cast<const T *>(myData); }
+			 {
+			    ensureData();
+			    return reinterpret_cast<const T *>(myData);
+			 }
 
 private:
-    GT_DataArrayHandle		 myAttrib;
-    const void			*myData;
+    void		 ensureData() const
+			 {
+			    // Values may be requested from several threads
+			    // during stage composition.
+			    if (myHasData.load())
+				return;
+
+			    UT_Lock::Scope lock(myDataLock);
+			    if (myHasData.relaxedLoad())
+				return;
+
+			    GT_DataArrayHandle	 storage;
+                            myData = myAttrib->getArray<ComponentT>(storage);
+
+			    if (storage)
+				myAttrib = storage;
+			    myHasData.store(true);
+			 }
+
+    mutable GT_DataArrayHandle	 myAttrib;
+    mutable const void		*myData;
+    mutable SYS_AtomicInt32	 myHasData;
+    mutable UT_Lock		 myDataLock;
     geo_AttribForeignSource	 myForeignSource;
 };
 
@@ -192,32 +230,56 @@ class GEO_FilePropAttribSource<std::string, std::string> :
 {
 public:
 			 GEO_FilePropAttribSource(
-				 const GT_DataArrayHandle &attrib)
-			     : myValue(attrib->entries())
+				 const GT_DataArrayHandle &attrib,
+				 bool defer = false)
+			     : myAttrib(attrib),
+			       myHasValue(false)
 			 {
-			    exint	 length = attrib->entries();
-
-			    for (exint i = 0; i < length; ++i)
-			    {
-				const GT_String	str = attrib->getS(i);
-
-				if (str)
-				    myValue[i] = str.toStdString();
-			    }
+			    if (!defer)
+				ensureValue();
 			 }
 
     bool	         copyData(const GEO_FileFieldValue &value) override
 			 {
+			    ensureValue();
 			    return value.Set(myValue);
 			 }
 
     GT_Size		 size() const
-			 { return myValue.size(); }
+			 { return myAttrib->entries(); }
     const std::string	*data() const
-			 { return myValue.data(); }
+			 {
+			    ensureValue();
+			    return myValue.cdata();
+			 }
 
 private:
-    VtArray<std::string> myValue;
+    void		 ensureValue() const
+			 {
+			    if (myHasValue.load())
+				return;
+
+			    UT_Lock::Scope lock(myValueLock);
+			    if (myHasValue.relaxedLoad())
+				return;
+
+			    exint	 length = myAttrib->entries();
+
+			    myValue.resize(length);
+			    for (exint i = 0; i < length; ++i)
+			    {
+				const GT_String	str = myAttrib->getS(i);
+
+				if (str)
+				    myValue[i] = str.toStdString();
+			    }
+			    myHasValue.store(true);
+			 }
+
+    GT_DataArrayHandle		 myAttrib;
+    mutable VtArray<std::string> myValue;
+    mutable SYS_AtomicInt32	 myHasValue;
+    mutable UT_Lock		 myValueLock;
 };
 
 
@@ -157,6 +157,11 @@ private:
         const GT_PrimitiveHandle &src_prim,
         const GEO_AgentShapeInfo &agentShapeInfo = GEO_AgentShapeInfo());
 
+    /// Returns the key identifying the prototype refined from the packed
+    /// primitive with this refiner's settings.
+    GEO_PrototypeKey prototypeKey(GT_GEOPrimPacked &gtpacked,
+                                  const TfToken &purpose) const;
+
     /// Creates or returns the point instancer for the given primitive path.
     UT_IntrusivePtr<GT_PrimPointInstancer>
     addPointInstancer(const UT_StringHolder &instancer_path,
@@ -215,10 +220,6 @@ private:
     // The known agent definitions and their prim paths
     UT_Map<GU_AgentDefinitionConstPtr, SdfPath> m_knownAgentDefs;
 
-    // Map from a packed primitive to the path where it was unpacked. Used for
-    // converting packed primitives to native instances.
-    UT_Map<GT_PackedInstanceKey, GEO_PathHandle> m_knownInstancedGeos;
-
     // Tracks the volume and field prims.
     UT_Map<SdfPath, UT_IntrusivePtr<GT_PrimVolumeCollection>> m_volumeCollections;
 
@@ -265,6 +266,11 @@ public:
 
     // Map used to generate unique names for each prim
     std::map<SdfPath, NameInfo> m_names;
+
+    // Map from a packed primitive to the path where it was unpacked. Used for
+    // converting packed primitives to native instances or point instancer
+    // prototypes. This is shared by all the refiners for the layer.
+    GEO_PrototypeRegistry m_prototypes;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -24,6 +24,11 @@
 #include <UT/UT_CappedCache.h>
 #include <UT/UT_IntrusivePtr.h>
 
+// Environment variable naming a scratch directory. When set, cooked geometry
+// is also saved there as bgeo so readers that have been evicted from
+// GEO_HAPIReaderCache can reload it instead of cooking the asset again.
+#define GEO_HAPI_SPILL_DIR_ENV "HOUDINI_HDA_USD_SPILL_DIR"
+
 typedef std::pair<fpreal32, GEO_HAPIGeoHandle> GEO_HAPITimeSample;
 typedef std::map<std::string, std::string> GEO_HAPIParameterMap;
 
@@ -87,11 +92,31 @@ public:
             const std::string &assetName = std::string(),
             const GEO_HAPIMetadataInfo &metaInfo = GEO_HAPIMetadataInfo());
 
+    // Cooks every time sample from startTime to endTime at the given interval
+    // while holding the session once, adding them to the time cache. Samples
+    // that are already cached are not loaded again. Equivalent to readHAPI()
+    // with GEO_HAPI_TIME_CACHING_RANGE
+    bool readHAPIRange(
+            const std::string &filePath,
+            const GEO_HAPIParameterMap &parmMap,
+            fpreal32 startTime,
+            fpreal32 endTime,
+            fpreal32 interval,
+            const std::string &assetName = std::string(),
+            const GEO_HAPIMetadataInfo &metaInfo = GEO_HAPIMetadataInfo());
+
     // Accessors
     bool hasPrim() const { return !myGeos.isEmpty(); }
     bool hasPrimAtTime(float time) const;
     GEO_HAPIGeoHandle getGeo(float time = 0.0f);
 
+    // Returns true if readHAPI() has already loaded geometry for these
+    // parameters at this time, so calling it again won't cook the asset
+    bool isCooked(const GEO_HAPIParameterMap &parmMap, float time) const
+    {
+        return myReadSuccess && myParms == parmMap && hasPrimAtTime(time);
+    }
+
     int64 getMemoryUsage() const override;
     int64 getMemoryUsage(bool inclusive) const;
 
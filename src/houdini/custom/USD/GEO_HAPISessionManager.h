@@ -20,11 +20,16 @@
 #include <HAPI/HAPI.h>
 #include <UT/UT_SharedPtr.h>
 #include <UT/UT_StopWatch.h>
+#include <UT/UT_StringHolder.h>
 #include <UT/UT_Lock.h>
 
 // Time to wait before closing an unused session in seconds:
 #define GEO_HAPI_SESSION_CLOSE_DELAY 60.0
 
+// Environment variable holding the maximum number of HAPI sessions that will
+// be started to spread asset loads across. Defaults to a single session.
+#define GEO_HAPI_SESSION_POOL_SIZE_ENV "HOUDINI_HDA_USD_SESSION_POOL_SIZE"
+
 typedef exint GEO_HAPISessionID;
 
 class GEO_HAPISessionStatus;
@@ -83,7 +88,13 @@ public:
     // used to access the session. A session remains open until all registered
     // users call unregister(). If the session fails to initialize, this will
     // return -1. Valid ids are never negative
-    static GEO_HAPISessionID registerAsUser();
+    //
+    // Up to GEO_HAPI_SESSION_POOL_SIZE_ENV sessions are started. If assetPath
+    // is given, a session that has already been assigned that asset is
+    // preferred so its library doesn't have to be loaded again. Otherwise the
+    // least busy session in the pool is chosen.
+    static GEO_HAPISessionID registerAsUser(
+            const UT_StringRef &assetPath = UT_StringRef());
 
     // Notifies the manager that the session is no longer being used. Should be
     // called once with the id returned from registerAsUser(). Using id after
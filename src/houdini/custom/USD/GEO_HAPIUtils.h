@@ -29,6 +29,7 @@
 #include <GT/GT_DataArray.h>
 #include <HAPI/HAPI.h>
 #include <UT/UT_Quaternion.h>
+#include <UT/UT_StringArray.h>
 #include <UT/UT_WorkBuffer.h>
 #include <pxr/usd/usdGeom/tokens.h>
 
@@ -89,6 +90,13 @@ bool GEOhapiExtractString(const HAPI_Session &session,
                           HAPI_StringHandle &handle,
                           UT_WorkBuffer &buf);
 
+// Resolves all the handles with a single batch request, appending the strings
+// to stringsOut in the same order as handles
+bool GEOhapiExtractStrings(const HAPI_Session &session,
+                           const HAPI_StringHandle *handles,
+                           int count,
+                           UT_StringArray &stringsOut);
+
 void GEOhapiSendCookError(const HAPI_Session &session);
 
 void GEOhapiSendError(const HAPI_Session &session);
@@ -23,6 +23,7 @@
 #include "pxr/usd/sdf/abstractData.h"
 #include "pxr/usd/sdf/data.h"
 #include "pxr/usd/sdf/fileFormat.h"
+#include <UT/UT_SharedPtr.h>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -94,6 +95,10 @@ protected:
 
     const GEO_FilePrim *getPrim(const SdfPath &id) const;
 
+    // Returns the shared prim map if one has been set, or myPrims.
+    const GEO_FilePrimMap &getPrimMap() const
+    { return mySharedPrims ? *mySharedPrims : myPrims; }
+
     // SdfAbstractData overrides
     void _VisitSpecs(
         SdfAbstractDataSpecVisitor *visitor) const override;
@@ -102,6 +107,9 @@ protected:
               const GEO_FileFieldValue &value) const;
 
     GEO_FilePrimMap myPrims;
+    // Read-only prims shared with other layers opened from the same source.
+    // When set, this is used instead of myPrims.
+    UT_SharedPtr<const GEO_FilePrimMap> mySharedPrims;
     GEO_FilePrim *myPseudoRoot;
     fpreal mySampleFrame;
     bool mySampleFrameSet;
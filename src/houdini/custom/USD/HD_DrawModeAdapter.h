@@ -27,6 +27,13 @@
 #include "pxr/pxr.h"
 #include "pxr/usdImaging/usdImagingGL/api.h"
 #include "pxr/usdImaging/usdImaging/primAdapter.h"
+#include "pxr/base/gf/matrix4d.h"
+#include "pxr/base/gf/range3d.h"
+#include "pxr/base/tf/hash.h"
+#include "pxr/base/tf/hashmap.h"
+
+#include <mutex>
+#include <string>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -134,6 +141,12 @@ private:
     // animated), and they are computed for purposes default/proxy/render.
     GfRange3d _ComputeExtent(UsdPrim const& prim) const;
 
+    // Returns the extents of the given prim, computing them with
+    // _ComputeExtent only if nothing is cached for cachePath yet.
+    // ProcessPropertyChange and _RemovePrim invalidate the cache.
+    GfRange3d _GetCachedExtent(UsdPrim const& prim,
+                               SdfPath const& cachePath) const;
+
     // Generate geometry for "origin" draw mode.
     void _GenerateOriginGeometry(VtValue* topo, VtValue* points,
                                  GfRange3d const& extents) const;
@@ -160,6 +173,10 @@ private:
     bool _GetMatrixFromImageMetadata(UsdAttribute const& attr, GfMatrix4d* mat)
         const;
 
+    // Open the image file and read its "worldtoscreen" metadata, bypassing
+    // the cache used by _GetMatrixFromImageMetadata.
+    bool _ReadMatrixFromImage(std::string const& file, GfMatrix4d* mat) const;
+
     // Generate texture coordinates for cards "cross"/"box" mode.
     void _GenerateTextureCoordinates(VtValue* uv, VtValue* assign,
                                      uint8_t axes_mask) const;
@@ -167,6 +184,22 @@ private:
     // Map from cachePath to what drawMode it was populated as.
     using _DrawModeMap = TfHashMap<SdfPath, TfToken, SdfPath::Hash>;
     _DrawModeMap _drawModeMap;
+
+    // Map from resolved texture path to the "worldtoscreen" matrix read from
+    // that image (and whether one was found). UpdateForTime runs in parallel,
+    // so access is guarded by _textureMatrixMutex.
+    using _TextureMatrixMap =
+        TfHashMap<std::string, std::pair<bool, GfMatrix4d>, TfHash>;
+    mutable _TextureMatrixMap _textureMatrixMap;
+    mutable std::mutex _textureMatrixMutex;
+
+    // Map from cachePath to the extents last computed for it. The extents
+    // are computed at a fixed time, so they stay valid until the extent
+    // attributes change or the prim is removed.
+    using _ExtentMap = TfHashMap<SdfPath, GfRange3d, SdfPath::Hash>;
+    mutable _ExtentMap _extentMap;
+    mutable std::mutex _extentMutex;
+
     bool _boundingBoxSupported;
 };
 
@@ -53,6 +53,34 @@ public:
 
     bool IsSupported(UsdImagingIndexProxy const* index) const override;
 
+    // ---------------------------------------------------------------------- //
+    /// \name Parallel Setup and Resolve
+    // ---------------------------------------------------------------------- //
+
+    /// Unlike the base light adapter, which treats the light params as
+    /// time-varying if any attribute has time samples, only report the
+    /// params as varying if an authored light attribute or the extent of
+    /// the source geometry might actually change over time.
+    void TrackVariability(UsdPrim const& prim,
+                          SdfPath const& cachePath,
+                          HdDirtyBits* timeVaryingBits,
+                          UsdImagingInstancerContext const* 
+                              instancerContext = NULL) const override;
+
+    // ---------------------------------------------------------------------- //
+    /// \name Change Processing 
+    // ---------------------------------------------------------------------- //
+
+    HdDirtyBits ProcessPropertyChange(UsdPrim const& prim,
+                                      SdfPath const& cachePath, 
+                                      TfToken const& propertyName) override;
+
+    /// Returns the path of the geometry which emits light for this light.
+    /// Geometry lights with the same source geometry can share the same
+    /// emissive shape, so render delegates can use this as a data sharing
+    /// id.  Returns an empty path if the light has no source geometry.
+    static SdfPath GetDataSharingId(UsdPrim const& prim);
+
 protected:
     void _RemovePrim(SdfPath const& cachePath,
 			UsdImagingIndexProxy* index) override final;
@@ -47,6 +47,21 @@ public:
     ~UsdHImagingHoudiniFieldAssetAdapter() override;
 
     TfToken GetPrimTypeToken() const override;
+
+    /// Only the attributes which select the field data (the file path,
+    /// field name and field index) can make the field params time-varying.
+    void TrackVariability(UsdPrim const& prim,
+                          SdfPath const& cachePath,
+                          HdDirtyBits* timeVaryingBits,
+                          UsdImagingInstancerContext const* 
+                              instancerContext = NULL) const override;
+
+    /// Only edits to the attributes which select the field data dirty the
+    /// field params, which makes render delegates reload the field.  Edits
+    /// to any other property leave the field clean.
+    HdDirtyBits ProcessPropertyChange(UsdPrim const& prim,
+                                      SdfPath const& cachePath, 
+                                      TfToken const& propertyName) override;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
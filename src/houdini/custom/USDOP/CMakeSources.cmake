@@ -4,6 +4,7 @@ set( sources
     HUSD_LopStageFactory.C
     OBJ_LOP.C
     OBJ_LOPCamera.C
+    OBJ_LOPXformTable.C
     SOP_LOP.C
     SOP_UnpackUSD.C
     XUSD_SelectionRuleAutoCollection.C
@@ -0,0 +1,114 @@
+/*
+ * Copyright 2019 Side Effects Software Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Produced by:
+ *	Side Effects Software Inc
+ *	123 Front Street West, Suite 1401
+ *	Toronto, Ontario
+ *	Canada   M5J 2M2
+ *	416-504-9876
+ *
+ * NAME:	OBJ_LOPXformTable.h (Custom Library, C++)
+ *
+ * COMMENTS:    A table of prim transforms shared by all the objects that
+ *		fetch their transforms from the same LOP node.
+ */
+
+#ifndef __OBJ_LOPXformTable__
+#define __OBJ_LOPXformTable__
+
+#include <HUSD/HUSD_Utils.h>
+#include <UT/UT_Lock.h>
+#include <UT/UT_Map.h>
+#include <UT/UT_Matrix4.h>
+#include <UT/UT_StringHolder.h>
+#include <UT/UT_StringMap.h>
+#include <pxr/pxr.h>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+class XUSD_Data;
+
+enum OBJ_LOPXformType
+{
+    OBJ_LOP_XFORMTYPE_LOCALTOWORLD,
+    OBJ_LOP_XFORMTYPE_LOCAL,
+    OBJ_LOP_XFORMTYPE_PARENTTOWORLD,
+};
+
+enum class OBJ_LOPXformStatus
+{
+    OK,
+    PRIM_NOT_FOUND,
+    PRIM_NO_XFORM
+};
+
+// Objects fetching transforms from a LOP node each need one prim transform
+// from the same stage at the same time. This singleton remembers which
+// transforms have been requested from each LOP node, and when the stage of
+// that LOP node changes (or is evaluated at a new time), computes all of
+// them together in parallel so the other objects can just look up their
+// result.
+class OBJ_LOPXformTable
+{
+public:
+    static OBJ_LOPXformTable	&getInstance();
+
+    // Returns the transform of the prim at primpath on the stage held by
+    // data, which must be read locked by the caller, at the current time.
+    OBJ_LOPXformStatus		 getTransform(int lopid,
+					const XUSD_Data &data,
+					const UT_StringHolder &primpath,
+					OBJ_LOPXformType xformtype,
+					UT_Matrix4D &xform,
+					HUSD_TimeSampling &time_sampling);
+
+    struct Result
+    {
+	UT_StringHolder		 myPrimPath;
+	OBJ_LOPXformType	 myXformType;
+	UT_Matrix4D		 myXform;
+	HUSD_TimeSampling	 myTimeSampling;
+	OBJ_LOPXformStatus	 myStatus;
+	// Set when an object asks for this result, so that transforms that
+	// nobody asked for since the last change aren't computed again.
+	bool			 myUsed = false;
+    };
+
+private:
+				 OBJ_LOPXformTable();
+				~OBJ_LOPXformTable();
+
+    struct Entry
+    {
+	// Identifies the stage contents and time the results were
+	// computed for.
+	UT_StringHolder		 myKey;
+	UT_StringMap<Result>	 myResults;
+	exint			 myLastUse = 0;
+    };
+
+    // Removes entries for LOP nodes that no longer exist, then the least
+    // recently used entries until there are at most theMaxEntries.
+    void			 pruneEntries();
+
+    UT_Map<int, Entry>		 myEntries;
+    exint			 myUseCounter = 0;
+    UT_Lock			 myLock;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif
@@ -52,6 +52,11 @@ protected:
 
     void                _UpdateFrame(const OP_Context &context);
 
+    /// Returns a key identifying the contents of the referenced LOP node's
+    /// stage at the import time, or an empty string if it can't be
+    /// determined.
+    UT_StringHolder     _GetLopContentKey(OP_Context &ctx);
+
     /// Adds all parms other than the import time as dependencies of
     /// myImportMicroNode.
     void                _AddParmDependencies();
@@ -69,7 +74,15 @@ private:
     /// Tracks whether the referenced LOP node or any parameters that affect
     /// how the packed prims are created have changed.
     DEP_TimedMicroNode      myImportMicroNode;
+    /// Tracks only the parameters that affect how the packed prims are
+    /// created, so that a change to the referenced LOP node can be
+    /// distinguished from a change to this node.
+    DEP_TimedMicroNode      myParmsMicroNode;
     exint                   myCachedDetailId = -1;
+    /// The HUSDgetStageCompositionKey() of the stage the cached packed prims
+    /// were created from. This includes the version of every layer used by
+    /// the stage, so editing or reloading any of them changes the key.
+    UT_StringHolder         myCachedContentKey;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -19,6 +19,7 @@
 
 #include <PRM/PRM_Template.h>
 #include <SOP/SOP_Node.h>
+#include <UT/UT_StringHolder.h>
 
 #include "gusd/defaultArray.h"
 #include "gusd/purpose.h"
@@ -27,6 +28,8 @@
 #include <pxr/pxr.h>
 #include "pxr/usd/usd/prim.h"
 
+class UT_WorkBuffer;
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 class GusdUSD_Traverse;
@@ -52,6 +55,18 @@ protected:
 
     OP_ERROR            _Cook(OP_Context& ctx);
 
+    /** Update the unpacked prims from the previous cook in place if only
+        the time or the transforms of the input prims changed. Returns
+        false if a full cook is needed.*/
+    bool                _UpdateInPlace(OP_Context& ctx);
+
+    /** Returns true if updating in place is enabled and possible with the
+        current parameters, and fills @a key with the parameter values
+        that affect the unpacked prims.*/
+    bool                _CanUpdateInPlace(const UT_String& traversal,
+                                          fpreal t,
+                                          UT_WorkBuffer& key);
+
     bool _Traverse(const UT_String& traversal,
                    const fpreal time,
                    const UT_Array<UsdPrim>& prims,
@@ -76,6 +91,11 @@ private:
     PRM_Default             _tabs[2];
     const GA_Group*         _group;
 
+    // What the last full cook unpacked, for _UpdateInPlace()
+    UT_Array<UsdPrim>                           _prevRootPrims;
+    UT_Array<GusdUSD_Traverse::PrimIndexPair>   _prevTraversed;
+    UT_StringHolder                             _prevKey;
+
 public:
     static void         Register(OP_OperatorTable* table);
 };
@@ -44,6 +44,7 @@ set( husd_sources
     HUSD_HydraLight.C
     HUSD_HydraMaterial.C
     HUSD_HydraPrim.C
+    HUSD_HydraSyncStats.C
     HUSD_Imaging.C
     HUSD_Info.C
     HUSD_KarmaShaderTranslator.C
@@ -82,6 +83,7 @@ set( husd_sources
     HUSD_TimeCode.C
     HUSD_TimeShift.C
     HUSD_Token.C
+    HUSD_TraceCapture.C
     HUSD_Utils.C
     HUSD_Xform.C
     HUSD_XformAdjust.C
@@ -156,6 +158,7 @@ set( husd_hdk_headers
     HUSD_GeoUtils.h
     HUSD_GetAttributes.h
     HUSD_GetMetadata.h
+    HUSD_HydraSyncStats.h
     HUSD_Imaging.h
     HUSD_Info.h
     HUSD_KarmaShaderTranslator.h
@@ -194,6 +197,7 @@ set( husd_hdk_headers
     HUSD_TimeCode.h
     HUSD_TimeShift.h
     HUSD_Token.h
+    HUSD_TraceCapture.h
     HUSD_Utils.h
     HUSD_Xform.h
     HUSD_XformAdjust.h
@@ -25,6 +25,8 @@
  * COMMENTS:
  *    Wrapper around the ArResolver and ArAsset classes.
  *    Assets use the form path/to/zip[filename.ext]
+ *    Uncompressed usdz members are read from a process-wide cache of
+ *    memory mapped packages, so their buffers and streams don't copy.
  */
 #ifndef HUSD_Asset_h
 #define HUSD_Asset_h
@@ -75,6 +75,16 @@ public:
     const UT_StringHolder &	getBindPrimPath() const 
 				{ return myBindPrimPath; }
 
+    /// When binding directly to more than this many primitives, bind the
+    /// material through a single collection on the primitives' closest
+    /// shared ancestor instead. This authors far fewer relationships, but
+    /// unlike direct bindings it won't override existing direct bindings
+    /// on the primitives. Zero (the default) disables this.
+    void			setAutoCollectionThreshold( exint threshold )
+				{ myAutoCollectionThreshold = threshold; }
+    exint			getAutoCollectionThreshold() const
+				{ return myAutoCollectionThreshold; }
+
     /// Enumeration of the material binding strength.
     enum class Strength
     {
@@ -101,6 +111,7 @@ private:
     Strength			myStrength;		// Binding strength
     UT_StringHolder		myPurpose;		// Binding purpose
     UT_StringHolder		myBindPrimPath;		// Collection location
+    exint			myAutoCollectionThreshold; // Auto collection size
 };
 
 #endif
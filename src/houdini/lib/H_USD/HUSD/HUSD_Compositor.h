@@ -25,6 +25,8 @@
 #define HUSD_Compositor_h
 
 #include <PXL/PXL_Common.h>
+#include <UT/UT_Array.h>
+#include <UT/UT_Rect.h>
 
 class PXL_Raster;
 
@@ -50,6 +52,20 @@ public:
     virtual void	 updateDepthBuffer(void *data,
                                            PXL_DataFormat df,
                                            int num_components) = 0;
+    // Update only the changed tiles of the GL color and depth buffer
+    // textures. The data is still the full resolution buffer, but only the
+    // pixels inside the tiles differ from the previous update. The default
+    // implementations upload the whole buffer.
+    virtual void	 updateColorBufferTiles(void *data,
+                                           PXL_DataFormat df,
+                                           int num_components,
+                                           const UT_Array<UT_DimRect> &tiles)
+			 { updateColorBuffer(data, df, num_components); }
+    virtual void	 updateDepthBufferTiles(void *data,
+                                           PXL_DataFormat df,
+                                           int num_components,
+                                           const UT_Array<UT_DimRect> &tiles)
+			 { updateDepthBuffer(data, df, num_components); }
     // Prim IDs for picking
     virtual void	 updatePrimIDBuffer(void *data,
                                             PXL_DataFormat df) = 0;
@@ -82,6 +82,17 @@ public:
                                 fpreal cliptimescale,
                                 const HUSD_ClipSegmentArray &segments) const;
 
+    // Build a clip manifest file from a set of clip files. The manifest
+    // declares every attribute that has time samples in any of the clips
+    // at or below the clip prim path. The clip files are scanned in
+    // parallel, and only their spec hierarchy and the presence of time
+    // samples are read, never the sample values. The clip files must be
+    // paths that can be opened directly, not paths relative to a layer.
+    static bool          createClipManifestFile(
+                                const UT_StringArray &clipfiles,
+                                const UT_StringRef &clipprimpath,
+                                const UT_StringRef &manifestfile);
+
 private:
     HUSD_AutoWriteLock	&myWriteLock;
 };
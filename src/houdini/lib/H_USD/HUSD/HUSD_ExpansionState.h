@@ -27,15 +27,14 @@
 
 #include "HUSD_API.h"
 #include "HUSD_Path.h"
-#include "HUSD_PathSet.h"
 #include <UT/UT_IntrusivePtr.h>
 #include <UT/UT_NonCopyable.h>
+#include <UT/UT_UniquePtr.h>
 #include <iosfwd>
 
 class UT_IStream;
-class UT_JSONValue;
-class UT_JSONWriter;
 class HUSD_ExpansionState;
+class husd_ExpansionNode;
 
 typedef UT_IntrusivePtr<HUSD_ExpansionState> HUSD_ExpansionStateHandle;
 
@@ -55,16 +54,16 @@ public:
 
     void			 clear();
     void			 copy(const HUSD_ExpansionState &src);
+    // The binary format is a compact tree with a shared table of names.
+    // Loading it only decodes each subtree the first time a path inside
+    // it is queried. The ASCII format is JSON. Both formats can be loaded.
     bool			 save(std::ostream &os, bool binary) const;
     bool			 load(UT_IStream &is);
 
 private:
-    bool			 save(UT_JSONWriter &writer,
-                                        HUSD_PathSet::iterator &iter) const;
-    bool			 load(const UT_JSONValue &value,
-                                        const HUSD_Path &path);
-
-    HUSD_PathSet                 myExpandedPaths;
+    // The expanded paths are stored as a tree of path components. It is
+    // mutable because encoded subtrees are decoded on demand.
+    mutable UT_UniquePtr<husd_ExpansionNode> myRoot;
 };
 
 #endif
@@ -27,6 +27,8 @@
 
 #include "HUSD_API.h"
 #include "HUSD_DataHandle.h"
+#include <UT/UT_Array.h>
+#include <UT/UT_StringArray.h>
 class HUSD_TimeCode;
 
 
@@ -41,6 +43,13 @@ public:
 			const UT_ExintArray &face_indices,
 			const UT_StringRef &subset_name ) const;
 
+    /// Creates many geometry subsets in a given primitive at once, which
+    /// is much faster than creating them one by one. The @p face_indices
+    /// and @p subset_names arrays must be the same length.
+    bool	createGeoSubsets( const UT_StringRef &prim_path,
+			const UT_Array<UT_ExintArray> &face_indices,
+			const UT_StringArray &subset_names ) const;
+
 
     /// @{ Get and set the geometry subset family name. 
     /// The subsets that have the same family name are logically tied
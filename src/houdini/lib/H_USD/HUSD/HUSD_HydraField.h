@@ -33,6 +33,7 @@
 #include "HUSD_HydraPrim.h"
 
 #include <GT/GT_Handles.h>
+#include <UT/UT_Lock.h>
 #include <UT/UT_StringHolder.h>
 #include <UT/UT_Vector3.h>
 #include <SYS/SYS_Types.h>
@@ -63,7 +64,11 @@ public:
     HUSD_PARM(FieldName,	UT_StringHolder);
     HUSD_PARM(FieldIndex,	int);
    
+    // Returns the volume primitive for this field, loading it if the field
+    // parameters have changed since it was last built.
     GT_PrimitiveHandle		 getGTPrimitive() const;
+    // Discard the cached primitive so the next getGTPrimitive() reloads it.
+    void			 dirtyGTPrimitive();
 
     // This static function converts a USD Field prim's attributes into a
     // GT_Primitive holding a native volume data structure. In addition to
@@ -80,6 +85,9 @@ private:
     UT_StringHolder                      myFilePath;
     UT_StringHolder                      myFieldName;
     int                                  myFieldIndex;
+    mutable GT_PrimitiveHandle           myGTPrim;
+    mutable UT_Lock                      myGTPrimLock;
+    mutable bool                         myGTPrimDirty;
     
     PXR_NS::XUSD_HydraField             *myHydraField;
 };
@@ -0,0 +1,104 @@
+/*
+ * Copyright 2019 Side Effects Software Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Produced by:
+ *	Side Effects Software Inc
+ *	123 Front Street West, Suite 1401
+ *	Toronto, Ontario
+ *	Canada   M5J 2M2
+ *	416-504-9876
+ *
+ * NAME:	HUSD_HydraSyncStats.h (HUSD Library, C++)
+ *
+ * COMMENTS:	Counters for the syncs of each type of hydra prim
+ */
+#ifndef HUSD_HydraSyncStats_h
+#define HUSD_HydraSyncStats_h
+
+#include "HUSD_API.h"
+#include <UT/UT_Lock.h>
+#include <UT/UT_NonCopyable.h>
+#include <UT/UT_StopWatch.h>
+#include <UT/UT_StringHolder.h>
+#include <UT/UT_StringMap.h>
+#include <SYS/SYS_Types.h>
+
+/// Counts how many times each type of hydra prim has been synced, how long
+/// those syncs took, how much data they converted, and which dirty bits
+/// caused them. Syncs happen in parallel, so recording is thread safe.
+class HUSD_API HUSD_HydraSyncStats : public UT_NonCopyable
+{
+public:
+    static constexpr int NUM_DIRTY_BITS = 32;
+
+    struct Stats
+    {
+	exint		 mySyncCount = 0;
+	fpreal64	 mySyncTime = 0.0;
+	int64		 myBytes = 0;
+	exint		 myDirtyBitCounts[NUM_DIRTY_BITS] = {};
+    };
+
+    /// Times a single sync of a prim, and records it when destroyed. If
+    /// bytes is supplied, the value it points to when the sync finishes is
+    /// added to the amount of data converted.
+    class HUSD_API AutoSync : public UT_NonCopyable
+    {
+    public:
+		 AutoSync(HUSD_HydraSyncStats &stats,
+			const UT_StringHolder &primtype,
+			uint32 dirtybits,
+			const int64 *bytes = nullptr);
+		~AutoSync();
+
+	/// Add to the amount of data converted by this sync.
+	void	 addBytes(int64 bytes)
+		 { myBytes += bytes; }
+
+    private:
+	HUSD_HydraSyncStats	&myStats;
+	UT_StringHolder		 myPrimType;
+	UT_StopWatch		 myTimer;
+	uint32			 myDirtyBits;
+	int64			 myBytes;
+	const int64		*myBytesSource;
+    };
+
+		 HUSD_HydraSyncStats();
+		~HUSD_HydraSyncStats();
+
+    void	 record(const UT_StringHolder &primtype,
+			uint32 dirtybits,
+			fpreal64 time,
+			int64 bytes);
+    void	 clear();
+
+    /// Return a copy of the stats recorded for each prim type.
+    void	 getStats(UT_StringMap<Stats> &stats) const;
+
+    /// Returns the name of a render statistic for a prim type, such as
+    /// "syncStats:mesh:count".
+    static UT_StringHolder	 statName(const UT_StringRef &primtype,
+					const char *stat);
+    /// Returns the counts of each dirty bit that triggered a sync as a
+    /// string of "bit:count" pairs, like "0x4:12 0x40:3".
+    static UT_StringHolder	 dirtyBitsString(const Stats &stats);
+
+private:
+    UT_StringMap<Stats>		 myStats;
+    mutable UT_Lock		 myLock;
+};
+
+#endif
@@ -40,6 +40,8 @@
 #include <pxr/pxr.h>
 
 PXR_NAMESPACE_OPEN_SCOPE
+class HdRenderBuffer;
+class TfToken;
 class VtValue;
 class XUSD_RenderSettings;
 class XUSD_RenderSettingsContext;
@@ -79,6 +81,11 @@ public:
 				const HUSD_ConstOverridesPtr &overrides);
     void		 setSelection(const UT_StringArray &paths);
     bool		 setFrame(fpreal frame);
+    // When rendering a frame sequence, scan the stage for time varying
+    // values whenever it changes. Changing frames on a stage with nothing
+    // animated then doesn't make Hydra dirty and resync anything.
+    void		 setSequenceRender(bool sequence);
+    bool		 sequenceRender() const { return mySequenceRender; }
     bool		 setHeadlight(bool doheadlight);
     void		 setLighting(bool enable);
     void                 setAspectPolicy(HUSD_Scene::ConformPolicy p);
@@ -180,6 +187,9 @@ public:
     bool                 isPaused() const;
 
     static bool		 getAvailableRenderers(HUSD_RendererInfoMap &info_map);
+    // Load and initialize a renderer plugin ahead of its first use (for
+    // example at session start) and keep it loaded.
+    static bool		 prewarmRenderer(const UT_StringRef &renderer_name);
 
     void                 setRenderSettings(const UT_StringRef &settings_path,
                                            int w=0, int h=0);
@@ -190,6 +200,33 @@ public:
 
     void                 getRenderStats(UT_Options &stats);
 
+    // Limit the time spent syncing deferred prims on each update, in
+    // seconds. Deferred prims are synced visible and nearest first; any that
+    // don't fit in the budget stay deferred for the next update. A budget of
+    // zero syncs all deferred prims at once.
+    void                 setDeferredUpdateBudget(fpreal seconds)
+                         { myDeferredBudget = seconds; }
+    fpreal               deferredUpdateBudget() const
+                         { return myDeferredBudget; }
+    // True if the last update ran out of budget before syncing all of the
+    // deferred prims, so another update should be scheduled.
+    bool                 hasPendingDeferredPrims() const
+                         { return myHasPendingDeferred; }
+
+    // When the ID buffers are lazy, compositing a render update doesn't
+    // upload the primId and instanceId AOVs. Call updateIDBuffers() before
+    // reading the compositor's ID rasters to upload them if they are out of
+    // date (returns true if they were uploaded), or readIDs() to read only
+    // a pick region straight from the render buffers.
+    void                 setLazyIDBuffers(bool lazy)
+                         { myLazyIDBuffers = lazy; }
+    bool                 lazyIDBuffers() const
+                         { return myLazyIDBuffers; }
+    bool                 updateIDBuffers();
+    bool                 readIDs(const UT_DimRect &rect,
+                                 UT_IntArray &prim_ids,
+                                 UT_IntArray &inst_ids);
+
     // Returns the path associated with a ID from a primId buffer.
     UT_StringHolder      lookupID(int path_id,
                                   int inst_id,
@@ -201,18 +238,27 @@ private:
     bool                 updateRestartCameraSettings() const;
     bool                 anyRestartRenderSettingsChanged() const;
     void		 updateLightsAndCameras();
-    void		 updateDeferredPrims();
+    void		 scanTimeVarying();
+    void		 poolImagingEngine();
+    void		 unpoolImagingEngine();
+    void		 updateDeferredPrims(const UT_Matrix4D &view_matrix,
+                                const UT_Matrix4D &proj_matrix);
     bool		 setupRenderer(const UT_StringRef &renderer_name,
                                 const UT_Options *render_opts);
     void                 updateSettingIfRequired(const UT_StringRef &key,
                                 const PXR_NS::VtValue &value);
     void                 updateSettingsIfRequired(HUSD_AutoReadLock &lock);
+    void                 applySettingChange(const PXR_NS::TfToken &key,
+                                const PXR_NS::VtValue &value);
     RunningStatus	 updateRenderData(const UT_Matrix4D &view_matrix,
                                           const UT_Matrix4D &proj_matrix,
                                           const UT_DimRect &viewport_rect,
                                           bool update_deferred,
                                           bool use_cam);
     void		 finishRender(bool do_render);
+    void                 uploadIDBuffers(PXR_NS::HdRenderBuffer *prim_id,
+                                         PXR_NS::HdRenderBuffer *inst_id,
+                                         int w, int h);
 
     UT_UniquePtr<husd_ImagingPrivate>	 myPrivate;
     fpreal				 myFrame;
@@ -229,7 +275,11 @@ private:
                                          mySettingsChanged : 1,
                                          myIsPaused : 1,
                                          myCameraSynced : 1,
-                                         myValidRenderSettingsPrim : 1;
+                                         myValidRenderSettingsPrim : 1,
+                                         myHasPendingDeferred : 1,
+                                         myLazyIDBuffers : 1,
+                                         myIDBuffersDirty : 1,
+                                         mySequenceRender : 1;
     HUSD_Scene				*myScene;
     UT_StringHolder			 myRendererName;
     HUSD_Compositor			*myCompositor;
@@ -246,6 +296,7 @@ private:
     husd_DefaultRenderSettingContext    *myRenderSettingsContext;
     int                                  myConformPolicy;
     HUSD_DepthStyle                      myDepthStyle;
+    fpreal                               myDeferredBudget;
 };
 
 #endif
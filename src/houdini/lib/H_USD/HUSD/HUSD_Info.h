@@ -118,6 +118,44 @@ public:
                                 DescendantStatsFlags
                                     flags = STATS_SIMPLE_COUNTS) const;
 
+    // Query several pieces of general information about many primitives
+    // at once. Only the fields requested in the PrimQueryFields bitmask are
+    // filled in. Each path is resolved only once, and the primitives are
+    // queried in parallel, so this is much faster than calling the
+    // individual methods above for each primitive.
+    enum PrimQueryFields {
+        QUERY_PRIM_TYPE = 0x0001,
+        QUERY_KIND = 0x0002,
+        QUERY_ACTIVE = 0x0004,
+        QUERY_VISIBLE = 0x0008,
+        QUERY_INSTANCE = 0x0010,
+        QUERY_PAYLOAD = 0x0020,
+        QUERY_ICON = 0x0040,
+        QUERY_PURPOSE = 0x0080,
+        QUERY_DRAW_MODE = 0x0100,
+        QUERY_HAS_CHILDREN = 0x0200,
+        QUERY_ALL = 0x03ff
+    };
+    class PrimQueryResult
+    {
+    public:
+        UT_StringHolder  myPrimType;
+        UT_StringHolder  myKind;
+        UT_StringHolder  myIcon;
+        UT_StringHolder  myPurpose;
+        UT_StringHolder  myDrawMode;
+        bool             myExists = false;
+        bool             myIsActive = false;
+        bool             myIsVisible = false;
+        bool             myIsInstance = false;
+        bool             myHasPayload = false;
+        bool             myHasChildren = false;
+    };
+    void                 queryPrims(const UT_StringArray &primpaths,
+                                int fields,
+                                const HUSD_TimeCode &time_code,
+                                UT_Array<PrimQueryResult> &results) const;
+
     UT_StringHolder	 getAncestorOfKind(const UT_StringRef &primpath,
 				const UT_StringRef &kind) const;
     UT_StringHolder	 getAncestorInstanceRoot(
@@ -207,6 +245,14 @@ public:
 				exint instance_index,
 				const UT_StringArray &purposes,
 				const HUSD_TimeCode &time_code) const;
+    // Returns the bounds of all the instances of a point instancer, in the
+    // space of the point instancer. The approximate bounds are faster to
+    // compute, and are always at least as large as the exact bounds.
+    UT_BoundingBoxD	 getPointInstancerTotalBounds(
+				const UT_StringRef &primpath,
+				const UT_StringArray &purposes,
+				const HUSD_TimeCode &time_code,
+				bool approximate = false) const;
 
     // Variants
     bool		 getVariantSets(const UT_StringRef &primpath,
@@ -20,6 +20,9 @@
 
 #include "HUSD_API.h"
 #include "HUSD_DataHandle.h"
+#include <UT/UT_UniquePtr.h>
+
+class husd_LayerCheckpointTracker;
 
 class HUSD_API HUSD_LayerCheckpoint
 {
@@ -27,11 +30,15 @@ public:
 			 HUSD_LayerCheckpoint();
                         ~HUSD_LayerCheckpoint();
 
+    // After the first checkpoint of a layer, creating a new checkpoint of
+    // (or restoring a checkpoint into) the same layer only copies the prims
+    // that have been edited since the last create or restore.
     void                 create(const HUSD_AutoAnyLock &lock);
     bool                 restore(const HUSD_AutoLayerLock &layerlock);
 
 private:
     PXR_NS::XUSD_LayerPtr myLayer;
+    UT_UniquePtr<husd_LayerCheckpointTracker> myTracker;
 };
 
 #endif
@@ -26,6 +26,11 @@
 #define __HUSD_LoadMasks_h__
 
 #include "HUSD_API.h"
+#include "HUSD_Path.h"
+#include <UT/UT_Array.h>
+#include <UT/UT_BitArray.h>
+#include <UT/UT_Lock.h>
+#include <UT/UT_SharedPtr.h>
 #include <UT/UT_StringSet.h>
 
 enum HUSD_LoadMasksMatchStyle
@@ -40,8 +45,11 @@ class HUSD_API HUSD_LoadMasks
 {
 public:
 			 HUSD_LoadMasks();
+			 HUSD_LoadMasks(const HUSD_LoadMasks &src);
 			~HUSD_LoadMasks();
 
+    HUSD_LoadMasks	&operator=(const HUSD_LoadMasks &src);
+
     bool		 operator==(const HUSD_LoadMasks&other) const;
     bool		 operator!=(const HUSD_LoadMasks&other) const
 			 { return !(*this == other); }
@@ -61,6 +69,19 @@ public:
     bool		 isPathPopulated(const UT_StringHolder &path,
 				HUSD_LoadMasksMatchStyle match =
                                     HUSD_MATCH_EXACT) const;
+    // Equivalent to the string version, but the populate paths are looked
+    // up as a sorted path tree, so ancestors and children are found with a
+    // single binary search instead of a search for every ancestor.
+    bool		 isPathPopulated(const HUSD_Path &path,
+				HUSD_LoadMasksMatchStyle match =
+                                    HUSD_MATCH_EXACT) const;
+    // Sets a bit in populated for each path in paths that is populated. The
+    // paths must be sorted, so they can all be answered with a single walk
+    // through the populate paths.
+    void		 arePathsPopulated(const UT_Array<HUSD_Path> &paths,
+				UT_BitArray &populated,
+				HUSD_LoadMasksMatchStyle match =
+                                    HUSD_MATCH_EXACT) const;
     const UT_SortedStringSet &populatePaths() const
 			 { return myPopulatePaths; }
 
@@ -89,15 +110,35 @@ public:
     bool		 isPathLoaded(const UT_StringHolder &path,
 				HUSD_LoadMasksMatchStyle match =
                                     HUSD_MATCH_EXACT) const;
+    bool		 isPathLoaded(const HUSD_Path &path,
+				HUSD_LoadMasksMatchStyle match =
+                                    HUSD_MATCH_EXACT) const;
+    void		 arePathsLoaded(const UT_Array<HUSD_Path> &paths,
+				UT_BitArray &loaded,
+				HUSD_LoadMasksMatchStyle match =
+                                    HUSD_MATCH_EXACT) const;
     const UT_SortedStringSet &loadPaths() const
 			 { return myLoadPaths; }
 
 private:
+    class PathTree;
+    typedef UT_SharedPtr<const PathTree> PathTreePtr;
+
+    PathTreePtr		 getPathTree(PathTreePtr &tree,
+				const UT_SortedStringSet &paths) const;
+    void		 clearPathTrees();
+
     UT_SortedStringSet	 myPopulatePaths;
     UT_SortedStringSet	 myMuteLayers;
     UT_SortedStringSet	 myLoadPaths;
     bool		 myPopulateAll;
     bool		 myLoadAll;
+
+    // Built from the path sets above the first time they are searched
+    // with an HUSD_Path, and thrown away whenever they change.
+    mutable PathTreePtr	 myPopulateTree;
+    mutable PathTreePtr	 myLoadTree;
+    mutable UT_Lock	 myPathTreeLock;
 };
 
 #endif
@@ -51,6 +51,10 @@ public:
                                  { return myStrippedLayers; }
     fpreal                       time() const
                                  { return myTime; }
+    // Returns true if the locked stage was composed without any load masks,
+    // so it contains exactly what opening its root layer would produce.
+    bool                         fullyLoaded() const
+                                 { return myFullyLoaded; }
     const UT_StringHolder	&getRootLayerIdentifier() const
 				 { return myRootLayerIdentifier; }
     const UT_StringHolder	&getStageCacheIdentifier() const
@@ -74,6 +78,7 @@ private:
     UT_StringHolder				 myStageCacheIdentifier;
     fpreal                                       myTime;
     bool					 myStrippedLayers;
+    bool					 myFullyLoaded;
     friend class				 HUSD_LockedStageRegistry;
 };
 
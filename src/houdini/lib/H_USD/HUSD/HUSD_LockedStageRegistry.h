@@ -27,6 +27,7 @@
 
 #include "HUSD_API.h"
 #include "HUSD_LockedStage.h"
+#include <UT/UT_Lock.h>
 #include <UT/UT_StringMap.h>
 #include <utility>
 
@@ -52,11 +53,19 @@ public:
     // destruction ordering.
     static void exitCallback(void *);
 
+    // Adds the number of locked stages of each LOP node to GusdStageCache
+    // memory reports. The memory of the stages themselves is reported with
+    // the other stages on the cache.
+    static void registerMemoryReporter();
+
     HUSD_LockedStagePtr		 getLockedStage(int nodeid,
 					const HUSD_DataHandle &data,
 					bool strip_layers,
                                         fpreal t,
 					HUSD_StripLayerResponse response);
+    // Release the locked stages for a node at one time, or at all times.
+    // A locked stage that is shared with other times of the same node stays
+    // registered until it has been released at all of those times.
     void			 clearLockedStage(int nodeid, fpreal t);
     void			 clearLockedStage(int nodeid);
 
@@ -77,6 +86,17 @@ private:
     // time, depending on the range of time samples for which the LOP has been
     // cooked.
     UT_Map<int, LockedStageMap> myLockedStageMaps;
+
+    // A map from the LOP node id to the locked stages of that LOP node keyed
+    // by the content of their layer stacks. A LOP node that doesn't change
+    // over time produces the same layers at every time, so all of those
+    // times can share a single locked stage.
+    UT_Map<int, LockedStageMap> myContentLockedStageMaps;
+
+    // Protects the maps above, which may be read from other threads by
+    // packedUSDTracker() and memory reports. When both are needed, this
+    // lock is always acquired after thePackedUSDRegistryLock.
+    UT_Lock			 myLock;
 };
 
 #endif
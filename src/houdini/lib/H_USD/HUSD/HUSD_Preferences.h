@@ -77,6 +77,11 @@ public:
     static void			 setUpdateRendererInBackground(
 					bool update_in_background);
 
+    // The number of imaging engines for renderers the viewport switched away
+    // from which are kept alive for quickly switching back.
+    static int			 maxPooledRenderers();
+    static void			 setMaxPooledRenderers(int max_pooled);
+
     static bool			 loadPayloadsByDefault();
     static void			 setLoadPayloadsByDefault(
 					bool load_payloads);
@@ -109,6 +114,7 @@ private:
     static bool			 thePanesShowViewportStage;
     static bool			 theAutoSetAssetResolverContext;
     static bool			 theUpdateRendererInBackground;
+    static int			 theMaxPooledRenderers;
     static bool			 theLoadPayloadsByDefault;
     static bool			 theUseSimplifiedLinkerUi;
     static double                theDefaultMetersPerUnit;
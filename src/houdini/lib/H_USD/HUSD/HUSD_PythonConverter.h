@@ -28,6 +28,9 @@
 #include "HUSD_API.h"
 #include "HUSD_DataHandle.h"
 #include "HUSD_Overrides.h"
+#include <UT/UT_StringHolder.h>
+
+class HUSD_TimeCode;
 
 class HUSD_API HUSD_PythonConverter
 {
@@ -55,6 +58,26 @@ public:
     void		*getOverridesLayer(
 				HUSD_OverridesLayerId layer_id) const;
 
+    // Returns a python object that exposes the value of a numeric array
+    // attribute through the buffer protocol, so numpy can view it without
+    // converting each element. The object holds a reference to the
+    // attribute value's storage, which USD copies before modifying, so it
+    // is a read-only snapshot that stays valid after the lock is released.
+    // Returns nullptr if the attribute doesn't hold a supported array type.
+    void		*getAttributeBuffer(const UT_StringRef &primpath,
+				const UT_StringRef &attrname,
+				const HUSD_TimeCode &timecode) const;
+    // Sets the value of a numeric array attribute from any python object
+    // that supports the buffer protocol, such as a numpy array, with a
+    // single copy. The buffer must be contiguous, its element type must
+    // match the scalar type of the attribute, and its shape must match the
+    // shape returned by getAttributeBuffer. Only works if the lock is an
+    // HUSD_AutoWriteLock.
+    bool		 setAttributeFromBuffer(const UT_StringRef &primpath,
+				const UT_StringRef &attrname,
+				void *buffer,
+				const HUSD_TimeCode &timecode) const;
+
     // Returns the lock the converter holds.
     HUSD_AutoAnyLock	*getLock() const
 			 { return myAnyLock; }
@@ -38,6 +38,16 @@ enum HUSD_DepthStyle
     HUSD_DEPTH_OPENGL
 };
 
+// How a render delegate needs to react to a change to one of its render
+// or camera settings, from the most to the least expensive.
+enum HUSD_SettingChange
+{
+    HUSD_SETTING_RESTART,	  // Rebuild the render delegate and its scene
+    HUSD_SETTING_REBUILD_LIGHTS,  // Pass to the delegate and resync lights
+    HUSD_SETTING_RERENDER,	  // Pass to the delegate, which re-renders
+    HUSD_SETTING_DISPLAY_ONLY	  // Only affects display; not sent at all
+};
+
 class HUSD_API HUSD_RendererInfo
 {
 public:
@@ -72,7 +82,13 @@ public:
 				 bool allowbackgroundupdate,
                                  bool aovsupport,
                                  bool drawmodesupport,
-				 bool husk_fastexit)
+				 bool husk_fastexit,
+				 const UT_StringArray &rebuildlightsettings =
+				     UT_StringArray(),
+				 const UT_StringArray &rerendersettings =
+				     UT_StringArray(),
+				 const UT_StringArray &displayonlysettings =
+				     UT_StringArray())
 			     : myName(name),
 			       myDisplayName(displayname),
 			       myMenuLabel(menulabel),
@@ -85,6 +101,9 @@ public:
                                myRestartRenderSettings(restartrendersettings),
                                myRestartCameraSettings(restartcamerasettings),
                                myRenderViewStats(renderstats),
+                               myRebuildLightSettings(rebuildlightsettings),
+                               myRerenderSettings(rerendersettings),
+                               myDisplayOnlySettings(displayonlysettings),
 			       myNeedsNativeDepthPass(needsnativedepth),
 			       myNeedsNativeSelectionPass(needsnativeselection),
 			       myAllowBackgroundUpdate(allowbackgroundupdate),
@@ -134,6 +153,20 @@ public:
     // when they are changed.
     const UT_StringArray &restartCameraSettings() const
 			 { return myRestartCameraSettings; }
+    // Patterns of settings which only need the lights to be resynced, only
+    // need a re-render, or only affect the display. These take precedence
+    // over the restart patterns above, so a delegate can restart on changes
+    // to "karma:*" except for a few cheaper settings.
+    const UT_StringArray &rebuildLightSettings() const
+			 { return myRebuildLightSettings; }
+    const UT_StringArray &rerenderSettings() const
+			 { return myRerenderSettings; }
+    const UT_StringArray &displayOnlySettings() const
+			 { return myDisplayOnlySettings; }
+    // Classify a change to the named render or camera setting. Settings not
+    // matching any pattern only need a re-render.
+    HUSD_SettingChange	 renderSettingChange(const UT_StringRef &name) const;
+    HUSD_SettingChange	 cameraSettingChange(const UT_StringRef &name) const;
     // Names of render statistics printed in the viewport when view stats is on
     const UT_StringArray &renderViewStats() const
 			 { return myRenderViewStats; }
@@ -174,6 +207,9 @@ private:
     UT_StringArray       myRestartRenderSettings;
     UT_StringArray       myRestartCameraSettings;
     UT_StringArray       myRenderViewStats;
+    UT_StringArray       myRebuildLightSettings;
+    UT_StringArray       myRerenderSettings;
+    UT_StringArray       myDisplayOnlySettings;
     bool		 myIsValid;
     bool		 myIsNativeRenderer;
     bool		 myNeedsNativeDepthPass;
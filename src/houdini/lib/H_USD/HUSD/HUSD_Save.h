@@ -92,7 +92,8 @@ public:
                                myErrorSavingImplicitPaths(false),
                                myIgnoreSavingImplicitPaths(false),
                                mySaveFilesFromDisk(false),
-                               myEnsureMetricsSet(false)
+                               myEnsureMetricsSet(false),
+                               myAsyncSave(false)
                          { }
 
     bool		 myClearHoudiniCustomData;
@@ -102,6 +103,7 @@ public:
     bool		 myIgnoreSavingImplicitPaths;
     bool		 mySaveFilesFromDisk;
     bool                 myEnsureMetricsSet;
+    bool                 myAsyncSave;
 };
 
 class HUSD_API HUSD_Save
@@ -171,6 +173,14 @@ public:
     void		 setEnsureMetricsSet(bool set)
 			 { myFlags.myEnsureMetricsSet = set; }
 
+    // When enabled, the layers for each save are written to disk on a
+    // background task while the next time sample is cooked. At most one
+    // save is pending at a time.
+    bool		 asyncSave() const
+			 { return myFlags.myAsyncSave; }
+    void		 setAsyncSave(bool async)
+			 { myFlags.myAsyncSave = async; }
+
     const UT_PathPattern *saveFilesPattern() const
 			 { return mySaveFilesPattern.get(); }
     void		 setSaveFilesPattern(const UT_StringHolder &pattern)
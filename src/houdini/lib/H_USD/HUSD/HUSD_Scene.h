@@ -30,6 +30,7 @@
 #include <pxr/pxr.h>
 
 #include "HUSD_API.h"
+#include <UT/UT_BitArray.h>
 #include <UT/UT_Lock.h>
 #include <UT/UT_LinkList.h>
 #include <UT/UT_Map.h>
@@ -39,10 +40,12 @@
 #include <UT/UT_StringSet.h>
 #include <UT/UT_IntrusivePtr.h>
 #include <UT/UT_Vector2.h>
+#include <SYS/SYS_AtomicInt.h>
 #include <SYS/SYS_Types.h>
 #include <GT/GT_Primitive.h>
 #include "HUSD_PrimHandle.h"
 #include "HUSD_HydraPrim.h"
+#include "HUSD_HydraSyncStats.h"
 #include "HUSD_Overrides.h"
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -80,6 +83,9 @@ public:
     UT_StringMap<HUSD_HydraLightPtr>    &lights()   { return myLights; }
     UT_StringMap<HUSD_HydraMaterialPtr> &materials(){ return myMaterials; }
 
+    // Counters for the syncs of the hydra prims in this scene.
+    HUSD_HydraSyncStats                 &syncStats() { return mySyncStats; }
+
     // all of these return true if the list was modified, false if the serial
     // matched;
     bool        fillGeometry(UT_Array<HUSD_HydraGeoPrimPtr> &array,
@@ -100,6 +106,20 @@ public:
     UT_StringHolder     lookupRenderPath(int id) const;
     int                 convertRenderID(int id) const;
 
+    // The Hydra generated selection ids of one render delegate, which can
+    // be set aside while that delegate isn't in use, and put back when it
+    // is used again (see HUSD_Imaging's pool of imaging engines).
+    struct RenderIDs
+    {
+        UT_StringMap<int>               myRenderIDs;
+        UT_Map<int,UT_StringHolder>     myRenderPaths;
+        UT_Map<int,int>                 myRenderIDtoGeomID;
+    };
+    // Moves the current render ids into ids, leaving none set.
+    void                stashRenderIDs(RenderIDs &ids);
+    // Replaces the current render ids with the stashed ones.
+    void                restoreRenderIDs(RenderIDs &ids);
+
     int                 getParentInstancer(int inst_id, bool topmost) const;
 
     static PXR_NS::XUSD_ViewerDelegate *newDelegate();
@@ -111,6 +131,11 @@ public:
 
     void addGeometry(HUSD_HydraGeoPrim *geo, bool new_geo);
     void removeGeometry(HUSD_HydraGeoPrim *geo);
+    // Register all geometry added since the last call with the scene tree.
+    // Called once the render delegate has committed its resources, and by
+    // getOrCreateID() and isSelected() during sync, which need the tree to
+    // hold every prim.
+    void commitPendingGeometry();
 
     void addDisplayGeometry(HUSD_HydraGeoPrim *geo);
     void removeDisplayGeometry(HUSD_HydraGeoPrim *geo);
@@ -310,6 +335,10 @@ protected:
     virtual void geometryDisplayed(HUSD_HydraGeoPrim *, bool) {}
     bool	 selectionModified(int id);
     bool         selectionModified(husd_SceneNode *pnode);
+    // Test whether an ID is directly in mySelection or myHighlight, using
+    // dense bitsets rebuilt whenever the selection or highlight changes.
+    bool         isInSelection(int id) const;
+    bool         isInHighlight(int id) const;
     UT_StringHolder instanceIDLookup(const UT_StringRef &pick_path,
                                      int path_id) const;
 
@@ -325,6 +354,8 @@ protected:
     // Update the tree for all instancers referring to prims, not point instances
     void         updateInstanceRefPrims();
     void         clearPendingRemovalPrims();
+    // commitPendingGeometry() for callers already holding myDisplayLock.
+    void         commitPendingGeometryLocked();
 
     UT_StringMap<int>			myPathIDs;
     UT_Map<int,UT_StringHolder>		myRenderPaths;
@@ -336,11 +367,13 @@ protected:
     UT_StringMap<HUSD_HydraCameraPtr>	myCameras;
     UT_StringMap<HUSD_HydraLightPtr>	myLights;
     UT_StringMap<HUSD_HydraMaterialPtr>	myMaterials;
+    HUSD_HydraSyncStats			mySyncStats;
     UT_Map<int, UT_StringHolder>        myMaterialIDs;
     UT_StringMap<HUSD_HydraGeoPrimPtr>  myPendingRemovalGeom;
     UT_StringMap<HUSD_HydraCameraPtr>   myPendingRemovalCamera;
     UT_StringMap<HUSD_HydraLightPtr>    myPendingRemovalLight;
     UT_Array<HUSD_HydraGeoPrimPtr>      myDuplicateGeo;
+    UT_Array<HUSD_HydraGeoPrimPtr>      myPendingGeometry;
     UT_Array<HUSD_HydraCameraPtr>       myDuplicateCam;
     UT_Array<HUSD_HydraLightPtr>        myDuplicateLight;
     UT_StringArray                      myRenderPrimNames;
@@ -356,6 +389,11 @@ protected:
     bool                                mySelectionArrayNeedsUpdate;
     int64				myHighlightID;
     int64				mySelectionID;
+    mutable UT_BitArray			myHighlightBits;
+    mutable UT_BitArray			mySelectionBits;
+    mutable SYS_AtomicInt64		myHighlightBitsID;
+    mutable SYS_AtomicInt64		mySelectionBitsID;
+    mutable UT_Lock			myBitsLock;
     int64				myGeoSerial;
     int64                               myModSerial;
     int64                               myCamSerial;
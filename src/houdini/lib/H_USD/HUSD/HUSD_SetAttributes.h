@@ -29,6 +29,7 @@
 #include "HUSD_API.h"
 #include "HUSD_DataHandle.h"
 #include "HUSD_TimeCode.h"
+#include <UT/UT_StringArray.h>
 #include <UT/UT_StringHolder.h>
 
 class UT_Options;
@@ -97,6 +98,31 @@ public:
                                  elementsize); }
     /// @}
 
+    /// @{ Set an attribute or primvar value on many primitives at once.
+    /// The @p values array holds either one value for each primitive path,
+    /// or a single value to set on all the primitives. The values are
+    /// converted in parallel and then authored directly on the layer specs
+    /// in a single change block, which is much faster than setting them one
+    /// primitive at a time. Attributes that already exist keep their type.
+    template<typename UtValueType>
+    bool		 setAttributeOnPrims(const UT_StringArray &primpaths,
+				const UT_StringRef &attrname,
+				const UT_Array<UtValueType> &values,
+				const HUSD_TimeCode &timecode,
+				const UT_StringRef &valueType = 
+				    UT_String::getEmptyString()) const;
+
+    template<typename UtValueType>
+    bool		 setPrimvarOnPrims(const UT_StringArray &primpaths,
+				const UT_StringRef &primvarname,
+				const UT_StringRef &interpolation,
+				const UT_Array<UtValueType> &values,
+				const HUSD_TimeCode &timecode,
+				const UT_StringRef &valueType = 
+				    UT_String::getEmptyString(),
+                                int elementsize = 1) const;
+    /// @}
+
     /// @{ Set attributes for every entry in a UT_Options object.
     bool		 setAttributes(const UT_StringRef &primpath,
 				const UT_Options &options,
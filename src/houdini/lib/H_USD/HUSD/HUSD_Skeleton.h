@@ -66,7 +66,9 @@ HUSDimportSkeletonPose(GU_Detail &gdp, const HUSD_AutoReadLock &readlock,
                        HUSD_SkeletonPoseType pose_type, fpreal time);
 
 /// Builds an agent rig from the SkelRoot's first Skeleton prim.
-HUSD_API GU_AgentRigPtr
+/// Rigs are cached until the layers they were imported from are modified, so
+/// the returned rig may be shared.
+HUSD_API GU_AgentRigConstPtr
 HUSDimportAgentRig(const HUSD_AutoReadLock &readlock,
                    const UT_StringRef &skelrootpath,
                    const UT_StringHolder &rig_name,
@@ -75,6 +77,8 @@ HUSDimportAgentRig(const HUSD_AutoReadLock &readlock,
 /// Imports all skinnable primitives underneath the provided SkelRoot prim
 /// (which are associated with the skeleton used for HUSDimportRig()), and adds
 /// the shape bindings to the provided layer.
+/// The imported shape geometry is cached and may be shared between shape
+/// libraries.
 HUSD_API bool
 HUSDimportAgentShapes(GU_AgentShapeLib &shapelib,
                       GU_AgentLayer &layer,
@@ -85,7 +89,8 @@ HUSDimportAgentShapes(GU_AgentShapeLib &shapelib,
 /// Initialize an agent clip from the animation associated with the skeleton
 /// used for HUSDimportAgentRig().
 /// The clip is assigned a name from the skeleton primitive's name.
-HUSD_API GU_AgentClipPtr
+/// Like the rig, the returned clip may be shared.
+HUSD_API GU_AgentClipConstPtr
 HUSDimportAgentClip(const GU_AgentRigConstPtr &rig,
                     HUSD_AutoReadLock &readlock,
                     const UT_StringRef &skelrootpath);
@@ -93,7 +98,7 @@ HUSDimportAgentClip(const GU_AgentRigConstPtr &rig,
 /// Import clips from the provided primitive pattern, which can match against
 /// either SkelRoot or Skeleton prims.
 /// The clips are assigned names from the USD primitives' names.
-HUSD_API UT_Array<GU_AgentClipPtr>
+HUSD_API UT_Array<GU_AgentClipConstPtr>
 HUSDimportAgentClips(const GU_AgentRigConstPtr &rig,
                      HUSD_AutoReadLock &readlock,
                      const UT_StringRef &prim_pattern);
@@ -37,6 +37,13 @@ public:
 			 HUSD_TimeShift(HUSD_AutoLayerLock &lock);
 			~HUSD_TimeShift();
 
+    // Authors the values of the time varying attributes of the found prims
+    // at sampleframe onto our layer at evaltime (or as defaults). This copies
+    // values rather than retiming through a sublayer offset or value clips,
+    // because an offset or clip applies to every prim in the layers it
+    // wraps, and we only have the one locked layer to edit. Callers that
+    // want to retime whole layers should use HUSD_EditLayers with an
+    // HUSD_LayerOffset instead.
     void		 shiftTime(const HUSD_FindPrims &findprims,
 				   fpreal evaltime,
 				   fpreal frame,
@@ -27,6 +27,9 @@
 
 #include "HUSD_API.h"
 #include <UT/UT_StringHolder.h>
+#include <pxr/pxr.h>
+#include <pxr/base/tf/token.h>
+#include <atomic>
 
 // Simple subclass of UT_StringHolder that can be used to indicate that a
 // string actually represents an asset path, rather than a raw string. Allows
@@ -38,6 +41,30 @@ public:
 			 HUSD_Token(const char *src);
 			 HUSD_Token(const std::string &src);
 			 HUSD_Token(const UT_StringHolder &src);
+			 HUSD_Token(const HUSD_Token &src);
+			 HUSD_Token(HUSD_Token &&src);
+			 HUSD_Token(const PXR_NS::TfToken &src);
+			~HUSD_Token();
+
+    HUSD_Token		&operator=(const HUSD_Token &src);
+    HUSD_Token		&operator=(HUSD_Token &&src);
+
+    // Returns the TfToken for this string. The Tf token registry is only
+    // searched the first time this is called, after which the token is
+    // cached, so it is safe and cheap to call from many threads.
+    const PXR_NS::TfToken &usdToken() const;
+
+private:
+    bool		 hasCachedToken() const
+			 { return myTokenSource.load(std::memory_order_acquire)
+				== c_str(); }
+
+    // The cached token remembers which string data it was created from,
+    // since the string can still be changed through the UT_StringHolder
+    // interface.
+    mutable PXR_NS::TfToken		 myToken;
+    mutable std::atomic<const char *>	 myTokenSource;
+    mutable std::atomic<bool>		 myTokenBusy;
 };
 
 #endif
@@ -0,0 +1,57 @@
+/*
+ * Copyright 2019 Side Effects Software Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Produced by:
+ *	Side Effects Software Inc
+ *	123 Front Street West, Suite 1401
+ *	Toronto, Ontario
+ *	Canada   M5J 2M2
+ *	416-504-9876
+ *
+ * NAME:	HUSD_TraceCapture.h (HUSD Library, C++)
+ *
+ * COMMENTS:	Captures a timeline of LOP cooks and Hydra syncs
+ */
+#ifndef HUSD_TraceCapture_h
+#define HUSD_TraceCapture_h
+
+#include "HUSD_API.h"
+#include <UT/UT_StringHolder.h>
+
+/// Records LOP cooks, stage compositions, traversals, Hydra syncs, render
+/// restarts and waits on contended locks with the USD trace collector, and
+/// saves them as a Chrome tracing JSON file (which Perfetto also reads).
+/// Every event records the thread it ran on, so serialization points show
+/// up as gaps in the other threads.
+///
+/// Capturing can also be enabled for a whole session by setting
+/// HOUDINI_USD_TRACE_CAPTURE_FILE to the file that should be written when
+/// Houdini exits.
+class HUSD_API HUSD_TraceCapture
+{
+public:
+    /// Discard any previously recorded events, and start recording.
+    static void		 start();
+    /// Stop recording, and write the events recorded since start() to
+    /// filepath. Returns false if nothing was being captured or the file
+    /// couldn't be written.
+    static bool		 stop(const UT_StringRef &filepath);
+    static bool		 isCapturing();
+
+    /// Starts capturing if HOUDINI_USD_TRACE_CAPTURE_FILE is set.
+    static void		 initialize();
+};
+
+#endif
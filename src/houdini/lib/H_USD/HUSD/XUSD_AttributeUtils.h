@@ -57,6 +57,14 @@ HUSDsetAttribute(const UsdAttribute &attribute,
         const PRM_Parm &parm, 
 	const UsdTimeCode &timecode); 
 
+/// Sets the given @p attribute to a @p value that already holds the type of
+/// the attribute, such as a value returned by HUSDgetCastVtValue(). This
+/// clears existing opinions in the same way as HUSDsetAttribute().
+HUSD_API bool
+HUSDsetAttributeValue(const UsdAttribute &attribute,
+        const VtValue &value,
+	const UsdTimeCode &timecode);
+
 HUSD_API bool
 HUSDsetNodeParm(PRM_Parm &parm,
         const UsdAttribute &attribute, 
@@ -111,6 +119,15 @@ template<typename UT_VALUE_TYPE>
 HUSD_API VtValue
 HUSDgetVtValue( const UT_VALUE_TYPE &ut_value );
 
+/// Converts a UT_* value object to a VtValue holding the given type, for
+/// passing to HUSDsetAttributeValue(). Returns an empty VtValue if the
+/// value can't be converted. This doesn't access the stage, so it's safe
+/// to call from many threads at once.
+template<typename UT_VALUE_TYPE>
+HUSD_API VtValue
+HUSDgetCastVtValue( const UT_VALUE_TYPE &ut_value,
+	const SdfValueTypeName &type );
+
 /// Returns the type of a shader input attribute given the VOP node input.
 HUSD_API SdfValueTypeName   HUSDgetShaderAttribSdfTypeName( 
 	const PRM_Parm &parm );
@@ -46,6 +46,9 @@
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+class xusd_LayerEditWatcher;
+class xusd_StageCache;
+
 enum XUSD_AddLayerOp
 {
     XUSD_ADD_LAYERS_ALL_LOCKED,
@@ -91,6 +94,9 @@ public:
     HUSD_OverridesPtr		 myWriteOverrides;
     SdfLayerRefPtr		 mySessionLayers[HUSD_OVERRIDES_NUM_LAYERS];
     exint			 myOverridesVersionId;
+    // Source layer edit generation the stage layers owned alongside this
+    // object were last synchronized against. See xusd_StageCache.
+    exint			 myStageGeneration;
 };
 
 typedef UT_Array<XUSD_LayerAtPath>	 XUSD_LayerAtPathArray;
@@ -204,6 +210,10 @@ public:
 					const HUSD_LockedStageArray &stages);
     const HUSD_LockedStageArray	&lockedStages() const;
 
+    // Adds the stages composed for LOP data, which aren't held by the
+    // GusdStageCache, to GusdStageCache memory reports.
+    static void			 registerMemoryReporter();
+
 private:
     void		 reset();
     void		 createNewData(const HUSD_LoadMasksPtr &load_masks,
@@ -257,6 +267,8 @@ private:
 				bool remove_layer_breaks = false);
     XUSD_LayerPtr	 editActiveSourceLayer();
     void                 createInitialPlaceholderSublayers();
+    void		 useCachedStage(
+				const HUSD_ConstOverridesPtr &read_overrides);
     void		 afterRelease();
 
     static void		 exitCallback(void *);
@@ -267,6 +279,7 @@ private:
     UT_SharedPtr<int>			 myStageLayerCount;
     UT_SharedPtr<XUSD_OverridesInfo>	 myOverridesInfo;
     UT_SharedPtr<XUSD_RootLayerData>     myRootLayerData;
+    UT_SharedPtr<xusd_StageCache>	 myStageCache;
     XUSD_LayerAtPathArray		 mySourceLayers;
     HUSD_LoadMasksPtr			 myLoadMasks;
     XUSD_DataLockPtr			 myDataLock;
@@ -278,6 +291,18 @@ private:
     bool                                 myMirrorLoadRulesChanged;
     int					 myActiveLayerIndex;
     bool				 myOwnsActiveLayer;
+    // While write locked, the source layer we inherited at the active layer
+    // index, and a watcher that tells us whether the stage's copy of it was
+    // actually edited. If not, we keep sharing the inherited layer rather
+    // than stashing a copy of it.
+    XUSD_LayerAtPath			 myInheritedActiveLayer;
+    SdfLayerRefPtr			 myStashLayer;
+    UT_UniquePtr<xusd_LayerEditWatcher>	 myActiveLayerWatcher;
+    // While write or layer locked, the versions (see HUSDgetLayerVersion)
+    // of our source layers when the lock was taken. Other stages in our
+    // stage cache only need to refresh their stage layers if one of these
+    // layers was edited in place during the lock.
+    UT_Array<std::pair<SdfLayerHandle, exint>> myLockedSourceLayerVersions;
 
     friend class ::HUSD_DataHandle;
 };
@@ -61,6 +61,11 @@ public:
 
 private:
     UT_Lock		 myMutex;
+    // Describes the source layers, root layer, and layer break setting
+    // the stage was composed with for the current read lock. Read locks
+    // from other nodes whose data produces the same key can share the
+    // composed stage instead of making a hard copy.
+    UT_StringHolder	 myReadLockKey;
     int			 myLockCount;
     int			 myLockedNodeId;
     bool		 myWriteLock;
@@ -26,6 +26,7 @@
 #include "XUSD_PathSet.h"
 #include "XUSD_Utils.h"
 #include <UT/UT_PathPattern.h>
+#include <UT/UT_StringHolder.h>
 #include <UT/UT_Task.h>
 #include <UT/UT_ThreadSpecificValue.h>
 #include <pxr/usd/usd/stage.h>
@@ -105,11 +106,21 @@ public:
     UT_Task *run() override;
 
 private:
+    // Used to spawn child tasks, which build their path strings for pattern
+    // matching by appending their name to the path string of the parent.
+    XUSD_FindPrimsTask(const UsdPrim& prim,
+            XUSD_FindPrimsTaskData &data,
+            const Usd_PrimFlagsPredicate &predicate,
+            const UT_PathPattern *pattern,
+            const XUSD_SimpleAutoCollection *autocollection,
+            const UT_StringHolder &parentpathstr);
+
     UsdPrim                          myPrim;
     XUSD_FindPrimsTaskData          &myData;
     const Usd_PrimFlagsPredicate    &myPredicate;
     const UT_PathPattern            *myPattern;
     const XUSD_SimpleAutoCollection *myAutoCollection;
+    UT_StringHolder                  myPathStr;
     bool                             myVisited;
 };
 
@@ -39,6 +39,7 @@
 #include <GT/GT_Transform.h>
 #include <GT/GT_Types.h>
 #include <GEO/GEO_PackedTypes.h>
+#include <UT/UT_Array.h>
 #include <UT/UT_StringMap.h>
 #include <UT/UT_Tuple.h>
 #include <UT/UT_Options.h>
@@ -133,6 +134,15 @@ protected:
 			     bool		       set_point_freq = false,
 			     bool		      *exists = nullptr,
                              GT_DataArrayHandle        vert_index = nullptr);
+
+    // Fetches and converts the dirty primvars among `attribs` in parallel.
+    // The following updateAttrib() calls for those primvars use the
+    // prefetched arrays instead of fetching them one at a time.
+    void	prefetchAttribs(HdSceneDelegate	      *scene_delegate,
+				const SdfPath	      &id,
+				HdDirtyBits	      *dirty_bits,
+				const UT_Array<std::pair<TfToken, GT_Type>>
+						      &attribs);
     
     void	createInstance(HdSceneDelegate          *scene_delegate,
 			       const SdfPath		&proto_id,
@@ -172,6 +182,7 @@ protected:
     UT_StringMap<UT_Tuple<GT_Owner,int, bool, void *> >  myAttribMap;
     UT_StringMap<UT_StringHolder> myExtraAttribs;
     UT_StringMap<UT_StringHolder> myExtraUVAttribs;
+    UT_StringMap<GT_DataArrayHandle> myPrefetchedAttribs;
     GT_PrimitiveHandle		&myGTPrim;
     GT_PrimitiveHandle		&myInstance;
     int				&myDirtyMask;
@@ -187,6 +198,8 @@ protected:
     UT_StringArray               myLightLink;
     UT_StringArray               myShadowLink;
     UT_StringArray               myMaterials;
+    // Memory used by the GT primitives created during the current sync.
+    int64                        myConvertedBytes;
     
     class InstStackEntry
     {
@@ -249,6 +262,11 @@ protected:
 
 
     GT_DataArrayHandle		 myCounts, myVertex;
+    // Point normals last generated, and the positions and vertex list they
+    // were generated from.
+    GT_DataArrayHandle		 myPointNormals;
+    GT_DataArrayHandle		 myPointNormalsP;
+    GT_DataArrayHandle		 myPointNormalsVertex;
     int64			 myTopHash;
     bool			 myIsSubD;
     bool			 myIsLeftHanded;
@@ -314,6 +332,9 @@ protected:
     HdDirtyBits _PropagateDirtyBits(HdDirtyBits bits) const override;
     void	_InitRepr(TfToken const &representation,
                           HdDirtyBits *dirty_bits) override;
+
+private:
+    GT_PrimitiveHandle myFieldPrim;
 };
 
 
@@ -30,6 +30,7 @@
 #define XUSD_HydraInstancer_h
 
 #include "HUSD_API.h"
+#include <UT/UT_ConcurrentHashMap.h>
 #include <UT/UT_Lock.h>
 #include <UT/UT_Map.h>
 #include <UT/UT_StringMap.h>
@@ -117,8 +118,10 @@ public:
     const UT_Map<int,int> &instanceRefs() const;
     void                clearInstanceRefs();
 
-    const UT_StringRef &getCachedResolvedInstance(const UT_StringRef &id_key);
-    void                cacheResolvedInstance(const UT_StringRef &id_key,
+    // Resolved instance paths are cached by the instance's pick ID, so
+    // looking up a pick ID does not require building its ID string.
+    UT_StringHolder     getCachedResolvedInstance(int pick_id) const;
+    void                cacheResolvedInstance(int pick_id,
                                               const UT_StringRef &resolved);
 
     int                 id() const { return myID; }
@@ -238,11 +241,23 @@ private:
                                           HUSD_Scene       *scene,
 					  float		    shutter_time,
                                           int               hou_proto_id = -1);
+    void            applyPrimvarTransforms(VtMatrix4dArray &transforms,
+                                           const VtIntArray &instanceIndices,
+                                           int seg0, int seg1,
+                                           float shutter) const;
+    VtMatrix4dArray sharedLocalTransforms(float shutter_time);
+    void            clearLocalTransforms();
     
-    UT_StringMap<UT_StringHolder>  myResolvedInstances;
+    typedef UT_ConcurrentHashMap<int, UT_StringHolder> ResolvedMap;
+
+    ResolvedMap                    myResolvedInstances;
     UT_Map<int,int>                myInstanceRefs;
     UT_StringMap<UT_Map<int,int> > myPrototypes;
     UT_Map<int, UT_StringHolder>   myPrototypeID;
+    // Per-index instance transforms built from the primvars, shared by all
+    // prototypes and keyed by shutter time.
+    UT_Map<float, VtMatrix4dArray> myLocalXforms;
+    UT_Lock                        myLocalXformLock;
     
     int  myID;
     bool myIsResolved;
@@ -31,7 +31,9 @@
 
 #include <pxr/pxr.h>
 #include <pxr/imaging/hd/renderBuffer.h>
+#include <UT/UT_Array.h>
 #include <UT/UT_Options.h>
+#include <UT/UT_Rect.h>
 #include <UT/UT_StringHolder.h>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -66,6 +68,19 @@ public:
     virtual bool IsMappedExtra(int idx) const = 0;
 #endif
     
+    /// Return a counter which increases whenever pixels in the primary buffer
+    /// change. Buffers which don't track their changes return -1, and must
+    /// always be treated as fully changed.
+    virtual int64 GetDataVersion() const { return -1; }
+
+    /// Fill @c tiles with the regions of the primary buffer which have
+    /// changed since @c version (a value previously returned by
+    /// GetDataVersion()). Returns false if the changed regions aren't known,
+    /// in which case the whole buffer must be treated as changed.
+    virtual bool GetDirtyTiles(int64 version,
+                               UT_Array<UT_DimRect> &tiles) const
+		 { return false; }
+
     /// Return arbitrary metadata associated with this AOV.
     /// Only string values are allowed at the moment.
     virtual const UT_Options &GetMetadata() const = 0;
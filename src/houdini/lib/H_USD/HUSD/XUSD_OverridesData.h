@@ -23,13 +23,39 @@
  */
 
 #include "HUSD_Utils.h"
+#include <UT/UT_Lock.h>
+#include <UT/UT_Map.h>
+#include <SYS/SYS_AtomicInt.h>
 #include <pxr/pxr.h>
+#include <pxr/base/tf/token.h>
 #include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/sdf/path.h>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
 class XUSD_Data;
 
+// The overrides authored on a single prim spec in the base overrides layer.
+enum
+{
+    XUSD_OVERRIDE_DRAWMODE	= 0x01,
+    XUSD_OVERRIDE_VISIBILITY	= 0x02
+};
+
+class XUSD_PrimOverrides
+{
+public:
+				 XUSD_PrimOverrides()
+				     : myFlags(0),
+				       myActive(true)
+				 { }
+
+    TfToken			 myDrawMode;
+    TfToken			 myVisibility;
+    unsigned char		 myFlags;
+    bool			 myActive;
+};
+
 class XUSD_OverridesData
 {
 public:
@@ -42,9 +68,26 @@ public:
     void			 lockToData(XUSD_Data *data);
     void			 unlockFromData(XUSD_Data *data);
 
+    // Returns the overrides authored on a prim in the base layer, or
+    // nullptr if the base layer has no spec for the prim. The index of
+    // overrides is built the first time it is needed after being dirtied.
+    const XUSD_PrimOverrides	*findPrimOverrides(const SdfPath &path) const;
+    // Refreshes the index entries for the given prims and their ancestors
+    // after they have been edited in the base layer.
+    void			 updatePrimOverrides(const SdfPathSet &paths);
+    // Forces a rebuild of the index, for edits that can't be tracked.
+    void			 dirtyPrimOverrides();
+
 private:
+    typedef UT_Map<SdfPath, XUSD_PrimOverrides> PrimOverridesMap;
+
+    void			 updatePrimOverrides(const SdfPath &path);
+
     XUSD_Data			*myLockedToData;
     SdfLayerRefPtr		 myLayer[HUSD_OVERRIDES_NUM_LAYERS];
+    mutable PrimOverridesMap	 myPrimOverrides;
+    mutable UT_Lock		 myPrimOverridesLock;
+    mutable SYS_AtomicInt32	 myPrimOverridesValid;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -39,6 +39,14 @@ public:
 
     const XUSD_PathSet  &operator=(const SdfPathSet &src);
 
+    // Add a large number of paths at once. The paths are sorted (in
+    // parallel) and deduplicated in place, then inserted in order so that
+    // each insertion is amortized constant time rather than a tree search.
+    void                 insertPaths(SdfPathVector &paths);
+    // Add all paths from another set, taking advantage of both sets being
+    // sorted in the same order.
+    void                 insertPaths(const SdfPathSet &paths);
+
     bool                 contains(const SdfPath &path) const;
     bool                 containsPathOrAncestor(const SdfPath &path,
                                 bool *contains = nullptr) const;
@@ -28,27 +28,58 @@
 #include "HUSD_API.h"
 #include <OP/OP_Node.h>
 #include <UT/UT_PerfMonAutoEvent.h>
+#include <UT/UT_UniquePtr.h>
+#include <UT/UT_WorkBuffer.h>
 #include <pxr/pxr.h>
+#include <pxr/base/trace/trace.h>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+// Records the time and memory used by part of a node's cook with the
+// performance monitor. By default nothing is recorded unless the node is
+// cooking. Operations that run on a node's data outside of its cook (such
+// as saving or mirroring the node's stage) can set require_cooking to false
+// to still attribute the event to the node. While a trace is being captured
+// (see HUSD_TraceCapture), the event is also added to the trace.
 class XUSD_PerfMonAutoCookEvent : public UT_PerfMonAutoEvent
 {
 public:
-    XUSD_PerfMonAutoCookEvent(int nodeid, const char *msg)
+    XUSD_PerfMonAutoCookEvent(int nodeid, const char *msg,
+            bool require_cooking = true)
     {
         UT_Performance      *perfmon = UTgetPerformance();
+        bool                 timed = perfmon->isRecordingCookStats();
+        bool                 memory = perfmon->isRecordingMemoryStats();
 
-        if (perfmon->isRecordingCookStats())
+        if (TraceCollector::IsEnabled())
         {
             OP_Node         *node = OP_Node::lookupNode(nodeid);
+            UT_WorkBuffer    buf;
 
-            if (node && node->isCooking(false))
-                setTimedEventId_(perfmon->startTimedCookEvent(nodeid, msg));
+            buf.format("{}: {}", node ? node->getFullPath() : "", msg);
+            myTraceScope.reset(new TraceAuto(buf.toStdString()));
+        }
+
+        if (timed || memory)
+        {
+            OP_Node         *node = OP_Node::lookupNode(nodeid);
+
+            if (node && (!require_cooking || node->isCooking(false)))
+            {
+                if (timed)
+                    setTimedEventId_(
+                        perfmon->startTimedCookEvent(nodeid, msg));
+                if (memory)
+                    setMemoryEventId_(
+                        perfmon->startMemoryCookEvent(nodeid, msg));
+            }
         }
     }
     ~XUSD_PerfMonAutoCookEvent()
     { }
+
+private:
+    UT_UniquePtr<TraceAuto>  myTraceScope;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
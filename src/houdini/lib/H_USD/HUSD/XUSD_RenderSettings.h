@@ -180,6 +180,8 @@ protected:
     TfToken		myAovToken;
     PXL_DataFormat	myDataFormat;
     PXL_Packing		myPacking;
+    bool		myResolved;
+    bool		myTimeVarying;
 };
 
 class HUSD_API XUSD_RenderProduct
@@ -43,6 +43,10 @@ public:
     static GU_DetailHandle	 getGeometry(const UT_StringRef &nodepath,
 					const XUSD_TicketArgs &args);
 
+    // Adds the geometry held by the registry to GusdStageCache memory
+    // reports.
+    static void			 registerMemoryReporter();
+
 private:
     static void			 returnTicket(const UT_StringHolder &nodepath,
 					const XUSD_TicketArgs &args);
@@ -43,6 +43,7 @@
 #include <pxr/usd/usd/stage.h>
 #include <pxr/usd/usd/timeCode.h>
 #include <pxr/usd/usd/stagePopulationMask.h>
+#include <functional>
 
 class HUSD_LayerOffset;
 class HUSD_LoadMasks;
@@ -117,6 +118,16 @@ HUSD_API bool HUSDgetNodePath(int nodeid, UT_StringHolder &nodepath);
 // Similar to the above method, but for the dedicated purpose of returning a
 // std::string to pass to HUSDcreateAnonymousLayer.
 HUSD_API std::string HUSDgetTag(const XUSD_DataLockPtr &datalock);
+// Returns a string describing the layers composed into the stage of the
+// supplied data. Two data objects with the same key have stages with the
+// same contents, so the key can be used to cache values computed from the
+// stage across cooks. Returns an empty string if the contents of the
+// stage can't be described cheaply (such as when there are layer breaks).
+HUSD_API std::string HUSDgetStageCompositionKey(const XUSD_Data &data);
+// Returns a number identifying the current contents of a layer. The version
+// changes whenever the layer is edited or reloaded, and is never shared by
+// two different layer objects.
+HUSD_API exint HUSDgetLayerVersion(const SdfLayerHandle &layer);
 
 HUSD_API const TfToken &HUSDgetDataIdToken();
 HUSD_API const TfToken &HUSDgetSavePathToken();
@@ -372,6 +383,13 @@ HUSDflattenLayerPartitions(const UsdStageWeakPtr &stage,
 HUSD_API SdfLayerRefPtr
 HUSDflattenLayers(const UsdStageWeakPtr &stage);
 
+// Flatten the composed stage into a single layer. Each root prim is
+// flattened in parallel on its own masked copy of the stage, and the
+// results are merged into one layer. Stages with instance masters or a
+// single root prim are flattened with UsdStage::Flatten directly.
+HUSD_API SdfLayerRefPtr
+HUSDflattenStage(const UsdStageWeakPtr &stage);
+
 // Check if the supplied layer is completely devoid of any useful information.
 // This includes both primitives and layer level metadata. However the presence
 // of only a HoudiniLayerInfo prim may still indicate an "empty" layer if it
@@ -400,6 +418,17 @@ HUSDgetBestRefPrimPath(const UT_StringRef &reffilepath,
 HUSD_API void
 HUSDclearBestRefPathCache(const std::string &layeridentifier = std::string());
 
+// Queues a task to run on the main thread. Background threads use this for
+// operations that are only safe on the main thread, such as reloading
+// layers. Queued tasks run the next time the main thread locks a data
+// handle while it holds no other data handle locks.
+HUSD_API void
+HUSDpostMainThreadTask(const std::function<void()> &task);
+// Runs any tasks queued by HUSDpostMainThreadTask. Must only be called from
+// the main thread while no stage is locked.
+HUSD_API void
+HUSDrunMainThreadTasks();
+
 // Functions for checking the amount of time sampling of an attribute/xfrom:
 HUSD_API HUSD_TimeSampling
 HUSDgetValueTimeSampling(const UsdAttribute &attrib);
@@ -13,6 +13,7 @@ set( gusd_sources
     GT_PackedUSD.cpp
     GT_PointInstancer.cpp
     GT_PrimCache.cpp
+    GT_TopologyCache.cpp
     GT_Utils.cpp
     GU_PackedUSD.cpp
     GU_USD.cpp
@@ -38,6 +39,7 @@ set( gusd_sources
     USD_StdTraverse.cpp
     USD_ThreadedTraverse.cpp
     USD_Traverse.cpp
+    USD_TraverseCache.cpp
     USD_Utils.cpp
     USD_VisCache.cpp
     USD_XformCache.cpp
@@ -65,6 +67,7 @@ set( gusd_hdk_headers
     GT_PackedUSD.h
     GT_PointInstancer.h
     GT_PrimCache.h
+    GT_TopologyCache.h
     GT_Utils.h
     GT_VtArray.h
     GT_VtStringArray.h
@@ -94,6 +97,7 @@ set( gusd_hdk_headers
     USD_StdTraverse.h
     USD_ThreadedTraverse.h
     USD_Traverse.h
+    USD_TraverseCache.h
     USD_TraverseSimple.h
     USD_Utils.h
     USD_VisCache.h
@@ -24,6 +24,8 @@
 #include "GEO_IOTranslator.h"
 
 #include "GU_PackedUSD.h"
+#include "GU_USD.h"
+#include "stageCache.h"
 
 #include <CH/CH_Manager.h>
 #include <GU/GU_Detail.h>
@@ -95,7 +97,13 @@ fileLoad(GEO_Detail* gdp, UT_IStream& is, bool ate_magic)
     }
 
     const std::string fileName = buffer.toStdString();
-    auto stage = UsdStage::Open( fileName, UsdStage::LoadNone);
+
+    // Go through the stage cache, so the stage and its layers are shared with
+    // the packed prims and any other gusd consumers of the same file.
+    GusdStageCacheReader cache;
+    UsdStageRefPtr stage = cache.FindOrOpen(UT_StringHolder(fileName),
+                                            GusdStageOpts::LoadNone(),
+                                            nullptr, UT_ERROR_NONE);
     if( !stage ) {
         return GA_Detail::IOStatus( false );
     }
@@ -112,20 +120,26 @@ fileLoad(GEO_Detail* gdp, UT_IStream& is, bool ate_magic)
 
     // If the file contains a default prim, load that,  otherwise load 
     // all the top level prims.
+    UT_Array<UsdPrim> prims;
     auto defPrim = stage->GetDefaultPrim();
     if(  defPrim ) {
-        GusdGU_PackedUSD::Build(*detail, fileName, defPrim.GetPath(), f, NULL,
-                                GusdPurposeSet(GUSD_PURPOSE_DEFAULT |
-                                               GUSD_PURPOSE_PROXY));
+        prims.append(defPrim);
     }
     else {
         for( const auto &child : stage->GetPseudoRoot().GetChildren() ) {
-            GusdGU_PackedUSD::Build(*detail, fileName, child.GetPath(), f, NULL,
-                                    GusdPurposeSet(GUSD_PURPOSE_DEFAULT |
-                                                   GUSD_PURPOSE_PROXY));
+            prims.append(child);
         }
     }
 
+    UT_Array<SdfPath> variants(prims.size(), prims.size());
+    GusdGU_USD::AppendPackedPrims(
+        *detail, prims, variants,
+        GusdDefaultArray<UsdTimeCode>(UsdTimeCode(f)),
+        GusdDefaultArray<UT_StringHolder>(),
+        GusdDefaultArray<GusdPurposeSet>(
+            GusdPurposeSet(GUSD_PURPOSE_DEFAULT | GUSD_PURPOSE_PROXY)),
+        GusdGU_PackedUSD::PivotLocation::Origin);
+
     return GA_Detail::IOStatus(true);
 }
 
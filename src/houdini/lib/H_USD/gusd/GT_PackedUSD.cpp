@@ -45,12 +45,12 @@
 #include <GT/GT_RefineCollect.h>
 #include <GT/GT_RefineParms.h>
 #include <GU/GU_PrimPacked.h>
-#include <UT/UT_Options.h>
+#include <UT/UT_Map.h>
+#include <UT/UT_ParallelUtil.h>
 
 #include "pxr/usd/usdGeom/xformCache.h"
 
 #include <iostream>
-#include <unordered_map>
 
 using std::cout;
 using std::cerr;
@@ -67,19 +67,6 @@ using std::vector;
 #define DBG(x)
 #endif
 
-namespace std {
-
-template <>
-struct hash<const UT_Options>
-{
-    size_t operator()(const UT_Options& options) const
-    {
-        return static_cast<size_t>(options.hash());
-    }
-};
-
-}
-
 PXR_NAMESPACE_OPEN_SCOPE
 
 namespace {
@@ -270,32 +257,76 @@ public:
         return false;
     }
 
+    /// Fills the untransformed bounds and full transforms of packed prims.
+    /// Packed prims may share an implementation, which lazily caches its
+    /// USD prim, bounds and transform without any locking. So prims are
+    /// grouped by implementation, and each group is filled by one thread.
+    /// This also means the bounds are only computed once per group.
     class FillTask
     {
     public:
+        typedef std::pair<const GU_PackedImpl*, exint>  ImplIndex;
+
         FillTask(UT_BoundingBox *boxes,
             UT_Matrix4F *xforms,
-            const UT_Array<const GU_PrimPacked *>&prims)
+            const UT_Array<const GU_PrimPacked *>&prims,
+            const UT_Array<ImplIndex> &order,
+            const UT_Array<exint> &groups)
             : myBoxes(boxes)
             , myXforms(xforms)
             , myPrims(prims)
+            , myOrder(order)
+            , myGroups(groups)
         {
         }
         void    operator()(const UT_BlockedRange<exint> &range) const
         {
             UT_Matrix4D     m4d;
-            for (exint i = range.begin(); i != range.end(); ++i)
+            UT_BoundingBox  box;
+            for (exint g = range.begin(); g != range.end(); ++g)
+            {
+                const exint start = myGroups(g);
+                const exint end = myGroups(g+1);
+
+                myPrims(myOrder(start).second)->getUntransformedBounds(box);
+                for (exint j = start; j < end; ++j)
+                {
+                    const exint i = myOrder(j).second;
+                    myBoxes[i] = box;
+                    myPrims(i)->getFullTransform4(m4d);
+                    myXforms[i] = m4d;
+                }
+            }
+        }
+
+        static void fill(UT_BoundingBox *boxes,
+            UT_Matrix4F *xforms,
+            const UT_Array<const GU_PrimPacked *>&prims)
+        {
+            const exint n = prims.entries();
+
+            UT_Array<ImplIndex> order(n, n);
+            for (exint i = 0; i < n; ++i)
+                order(i) = ImplIndex(prims(i)->sharedImplementation(), i);
+            UTparallelSort(order.begin(), order.end());
+
+            UT_Array<exint> groups;
+            for (exint i = 0; i < n; ++i)
             {
-                const GU_PrimPacked &prim = *myPrims(i);
-                prim.getUntransformedBounds(myBoxes[i]);
-                prim.getFullTransform4(m4d);
-                myXforms[i] = m4d; 
+                if (i == 0 || order(i).first != order(i-1).first)
+                    groups.append(i);
             }
+            groups.append(n);
+
+            UTparallelFor(UT_BlockedRange<exint>(0, groups.entries()-1),
+                FillTask(boxes, xforms, prims, order, groups));
         }
     private:
         UT_BoundingBox  *myBoxes;
         UT_Matrix4F     *myXforms;
         const UT_Array<const GU_PrimPacked *>   &myPrims;
+        const UT_Array<ImplIndex>               &myOrder;
+        const UT_Array<exint>                   &myGroups;
     };
 
     void
@@ -375,9 +406,10 @@ public:
 
         if (nbox)
         {
-            //UTparallelFor(UT_BlockedRange<exint>(0, nbox),
-            UTserialFor(UT_BlockedRange<exint>(0, nbox),
-                FillTask(boxes, xforms, _boxPrims));
+            FillTask::fill(boxes, xforms, _boxPrims);
+
+            // GT_GEOPrimCollectBoxes can only be appended to serially,
+            // but all the expensive work has been done above.
             for (exint i = 0; i < nbox; ++i)
             {
                 boxdata.appendBox(boxes[i], xforms[i],
@@ -390,9 +422,7 @@ public:
         }
         if (ncentroid)
         {
-            //UTparallelFor(UT_BlockedRange<exint>(0, ncentroid),
-            UTserialFor(UT_BlockedRange<exint>(0, ncentroid),
-                FillTask(boxes, xforms, _centroidPrims));
+            FillTask::fill(boxes, xforms, _centroidPrims);
             for (exint i = 0; i < ncentroid; ++i)
             {
                 boxdata.appendCentroid(boxes[i], xforms[i],
@@ -406,27 +436,15 @@ public:
         if( ngeo ) {
 
             // sort packed prims into collections of identical instances
-            std::unordered_map<const UT_Options, UT_Array<const GU_PrimPacked*> >
-                                    instanceMap;
+            UT_Map<GusdGU_PackedUSDInstanceKey,
+                   UT_Array<const GU_PrimPacked*> > instanceMap;
 
             for( auto const & prim : _geoPrims ) {
 
                 auto  impl = 
                     UTverify_cast<const GusdGU_PackedUSD*>(prim->sharedImplementation());
 
-                UT_Options instanceKey;                
-                impl->getInstanceKey(instanceKey);
-                auto instanceMapIt = instanceMap.find(instanceKey);
-                if (instanceMapIt == instanceMap.end())
-                {
-                    UT_Array<const GU_PrimPacked*> prims;
-                    prims.append(prim);
-                    instanceMap[instanceKey] = prims;
-                }
-                else
-                {
-                    instanceMapIt->second.append(prim);                    
-                }
+                instanceMap[impl->getInstanceKey()].append(prim);
             }
 
             // Iterate over groups of instances
@@ -30,6 +30,7 @@
 #include "USD_StdTraverse.h"
 #include "USD_XformCache.h"
 #include "UT_Gf.h"
+#include "stageCache.h"
 
 #include "pxr/usd/usdGeom/boundable.h"
 #include "pxr/usd/usdGeom/xformable.h"
@@ -42,9 +43,19 @@
 #include <GT/GT_RefineParms.h>
 #include <GT/GT_TransformArray.h>
 #include <GT/GT_PackedAlembic.h>
+#include <SYS/SYS_AtomicInt.h>
 #include <SYS/SYS_Hash.h>
+#include <UT/UT_Exit.h>
 #include <UT/UT_HDKVersion.h>
+#include <UT/UT_Lock.h>
+#include <UT/UT_Map.h>
+#include <UT/UT_Thread.h>
+#include <UT/UT_ThreadQueue.h>
 
+#include "pxr/base/tf/getenv.h"
+#include "pxr/base/trace/trace.h"
+
+#include <atomic>
 #include <iostream>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -59,6 +70,11 @@ using std::vector;
 using std::cerr;
 using std::endl;
 
+TF_DEFINE_ENV_SETTING(GUSD_GT_PRIMCACHE_PREFETCH_FRAMES, 0,
+                      "Number of frames following the frame being drawn "
+                      "that GusdGT_PrimCache refines in the background "
+                      "during playback. 0 disables prefetching.");
+
 typedef UT_IntrusivePtr<GT_PrimPolygonMesh> GT_PrimPolygonMeshHandle;
 
 
@@ -203,6 +219,219 @@ namespace {
 
     typedef GusdUT_CappedKey<CacheKeyValue, CacheKeyValue::HashCmp> CacheKey;
 
+    /// Returns false for prims that are known not to change over time.
+    /// Finding out for certain whether a group has animated descendants is
+    /// about as expensive as refining it, so groups are only assumed to be
+    /// static if their stage has no time samples at all.
+    bool
+    MightBeTimeVarying( const UsdPrim &prim )
+    {
+        if( !prim.GetStage()->HasAuthoredTimeCodeRange() ) {
+            return false;
+        }
+        if( prim.IsA<UsdGeomBoundable>() && !prim.IsInstance() ) {
+            for( const UsdAttribute &attr : prim.GetAttributes() ) {
+                if( attr.ValueMightBeTimeVarying() ) {
+                    return true;
+                }
+            }
+            return false;
+        }
+        return true;
+    }
+
+    /// Background thread that refines prims into the GT prim cache ahead
+    /// of playback. Requests are tagged with a generation, which is bumped
+    /// whenever the requested frames of a prim stop following each other,
+    /// so that stale requests are discarded without being refined.
+    class Prefetcher {
+    public:
+        static Prefetcher&  GetInstance()
+                            {
+                                static Prefetcher prefetcher;
+                                return prefetcher;
+                            }
+
+        void    Request( const UsdPrim &prim,
+                         UsdTimeCode time,
+                         GusdPurposeSet purposes,
+                         int numFrames );
+
+        void    Cancel() { m_generation.add(1); }
+
+    private:
+        struct Item {
+            Item() : generation(0) {}
+
+            UsdPrim         prim;
+            // Keeps the stage alive until the request is handled.
+            UsdStageRefPtr  stage;
+            UsdTimeCode     time;
+            GusdPurposeSet  purposes;
+            exint           generation;
+        };
+
+        /// The last frame requested for a prim, and the step between the
+        /// last two frames requested for it.
+        struct Playback {
+            UsdTimeCode     lastTime = UsdTimeCode::Default();
+            double          step = 1.0;
+        };
+
+        struct PrimHash {
+            size_t operator()( const UsdPrim &prim ) const
+                   { return hash_value( prim ); }
+        };
+
+        // Limits on the pending requests, and on the number of prims whose
+        // playback is tracked, beyond which new requests are dropped.
+        static const exint  theMaxPendingRequests = 1024;
+        static const exint  theMaxTrackedPrims = 4096;
+
+        Prefetcher()
+            : m_thread( NULL )
+            , m_generation( 0 )
+            , m_pending( 0 )
+            , m_exit( false ) {}
+
+        void            start();
+        static void*    run( void *data );
+        static void     exitCB( void *data );
+
+        UT_ThreadQueue<Item>    m_queue;
+        UT_Thread*              m_thread;
+        UT_Lock                 m_lock;
+        SYS_AtomicInt<exint>    m_generation;
+        SYS_AtomicInt<exint>    m_pending;
+        UT_Map<UsdPrim, Playback, PrimHash> m_playback;
+        std::atomic<bool>       m_exit;
+    };
+
+    void
+    Prefetcher::Request( const UsdPrim &prim,
+                         UsdTimeCode time,
+                         GusdPurposeSet purposes,
+                         int numFrames )
+    {
+        if( m_pending.relaxedLoad() + numFrames > theMaxPendingRequests ) {
+            return;
+        }
+
+        double step;
+        exint generation;
+        {
+            UT_AutoLock lock( m_lock );
+
+            if( m_exit ) {
+                return;
+            }
+            if( !m_thread ) {
+                start();
+            }
+
+            if( m_playback.size() >= theMaxTrackedPrims &&
+                !m_playback.contains( prim )) {
+                m_playback.clear();
+            }
+
+            // Moving ahead by up to numFrames from the last frame requested
+            // for this prim is playback. Anything else is a scrub, which
+            // makes all pending requests useless.
+            Playback &playback = m_playback[prim];
+            if( time != playback.lastTime ) {
+                if( !playback.lastTime.IsDefault() ) {
+                    const double delta =
+                        time.GetValue() - playback.lastTime.GetValue();
+                    if( delta > 0 && delta <= numFrames ) {
+                        playback.step = delta;
+                    } else {
+                        m_generation.add(1);
+                    }
+                }
+                playback.lastTime = time;
+            }
+            step = playback.step;
+            generation = m_generation.relaxedLoad();
+        }
+
+        Item item;
+        item.prim = prim;
+        item.stage = prim.GetStage();
+        item.purposes = purposes;
+        item.generation = generation;
+        for( int i = 1; i <= numFrames; ++i ) {
+            item.time = UsdTimeCode( time.GetValue() + i * step );
+            m_pending.add(1);
+            m_queue.append( item );
+        }
+    }
+
+    void
+    Prefetcher::start()
+    {
+        m_thread = UT_Thread::allocThread(
+            UT_Thread::SpinMode::ThreadSingleRun, false );
+        m_thread->startThread( run, this );
+        UT_Exit::addExitCallback( exitCB, this );
+    }
+
+    void*
+    Prefetcher::run( void *data )
+    {
+        Prefetcher &self = *static_cast<Prefetcher*>( data );
+        GusdGT_PrimCache &cache = GusdGT_PrimCache::GetInstance();
+
+        while( !self.m_exit ) {
+            Item item;
+            while( !self.m_exit && self.m_queue.remove( item ) ) {
+                self.m_pending.add(-1);
+                if( item.generation != self.m_generation.relaxedLoad() ) {
+                    continue;
+                }
+
+                // Hold a reader on the stage cache while refining, so the
+                // stage can't be cleared or reloaded by a writer on another
+                // thread while it's being read.
+                GusdStageCacheReader reader;
+                if( !item.prim.IsValid() ) {
+                    continue;
+                }
+                // Stop filling the cache before it starts evicting the
+                // prims being drawn right now.
+                if( !cache.HasPrefetchBudget() ) {
+                    continue;
+                }
+                cache.GetPrim( item.prim, item.time, item.purposes );
+            }
+            if( !self.m_exit ) {
+                self.m_queue.waitForQueueChange();
+            }
+        }
+        return NULL;
+    }
+
+    void
+    Prefetcher::exitCB( void *data )
+    {
+        Prefetcher &self = *static_cast<Prefetcher*>( data );
+        UT_Thread *thread;
+        {
+            UT_AutoLock lock( self.m_lock );
+            self.m_exit = true;
+            self.m_generation.add(1);
+            thread = self.m_thread;
+            self.m_thread = NULL;
+        }
+        if( !thread ) {
+            return;
+        }
+        // Wake up the thread so it sees the exit flag, and let it finish
+        // the prim it may be refining.
+        self.m_queue.append( Item() );
+        thread->waitForState( UT_Thread::ThreadIdle );
+        delete thread;
+    }
+
 }; // end namespace 
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -232,25 +461,74 @@ GusdGT_PrimCache::GetPrim( const UsdPrim &usdPrim,
                            GusdPurposeSet purposes,
                            bool skipRoot )
 {
-    // We need to skip the root when walking into instance masters.
+    TRACE_FUNCTION();
 
     if( !usdPrim.IsValid() ) {
         return GT_PrimitiveHandle();
     }
 
-    CacheKey key(CacheKeyValue(usdPrim, time, purposes));
+    // Native instances and instance proxies are keyed by the corresponding
+    // prim in their master, so every instance of a prototype shares a single
+    // cache entry and gets back the same GT prim handle. Groups that contain
+    // several of them then build GT_PrimInstances from that handle, which
+    // the viewport draws as GPU instances.
+    UsdPrim keyPrim = usdPrim;
+    if( usdPrim.IsInstance() ) {
+        keyPrim = usdPrim.GetMaster();
+        skipRoot = true;
+    }
+    else if( usdPrim.IsInstanceProxy() ) {
+        keyPrim = usdPrim.GetPrimInMaster();
+        skipRoot = true;
+    }
+    if( !keyPrim.IsValid() ) {
+        return GT_PrimitiveHandle();
+    }
+
+    CacheKey key(CacheKeyValue(keyPrim, time, purposes));
 
     CreateEntryFn createFunc(*this);
     auto entry = _prims.FindOrCreate<CacheEntry>( key, createFunc,
-                                                  usdPrim, time, 
+                                                  keyPrim, time, 
                                                   purposes, skipRoot );
     
     return entry ? entry->prim : NULL;    
 }
 
+void
+GusdGT_PrimCache::Prefetch( const UsdPrim &usdPrim,
+                            UsdTimeCode time,
+                            GusdPurposeSet purposes )
+{
+    static const int numFrames =
+        TfGetEnvSetting(GUSD_GT_PRIMCACHE_PREFETCH_FRAMES);
+
+    if( numFrames <= 0 || time.IsDefault() || !usdPrim.IsValid() ) {
+        return;
+    }
+    if( !MightBeTimeVarying( usdPrim ) ) {
+        return;
+    }
+    Prefetcher::GetInstance().Request( usdPrim, time, purposes, numFrames );
+}
+
+void
+GusdGT_PrimCache::CancelPrefetch()
+{
+    Prefetcher::GetInstance().Cancel();
+}
+
+bool
+GusdGT_PrimCache::HasPrefetchBudget() const
+{
+    // Leave a quarter of the cache for the frames being drawn.
+    return _prims.GetMemoryUsage() < _prims.GetMaxMemoryUsage() / 4 * 3;
+}
+
 void
 GusdGT_PrimCache::Clear()
 {
+    CancelPrefetch();
     _prims.clear();
 }
 
@@ -279,13 +557,13 @@ CreateEntryFn::operator()(
     // Build a cache entry for a USD Prim. A cache entry contains a GT_Primitive
     // that can be used to draw the usd prim. 
     //
-    // Handle 3 different cases differently. 
+    // Handle 2 cases differently.
     //
     // USD gprims (leaves in the hierarchy) are just converted to GT_Primitives. 
     //
-    // For USD native instances, find the instance's master or the prim in
-    // master corresponding to an instance proxy, and recurse on that. This way
-    // each instance should share a cache with its master.
+    // USD native instances and instance proxies never get here, GetPrim()
+    // maps them to the corresponding prim in their master, so each instance
+    // shares its master's cache entry.
     //
     // Any other USD primitive represents a branch of the USD hierarchy. Find 
     // all the instances and leaves in this branch and build a GT_PrimCollect 
@@ -301,25 +579,7 @@ CreateEntryFn::operator()(
     GT_RefineParms refineParms;
     refineParms.setPackedViewportLOD( true );
 
-    bool isInstance = prim.IsInstance();
-    bool isInstanceProxy = prim.IsInstanceProxy();
-    if( isInstance || isInstanceProxy)
-    {
-        DBG( cerr << "Create prim cache for instance " << prim.GetPath() << " at " << time << endl; )
-        // Look for a cache entry from the instance master
-        UsdPrim masterPrim = isInstance ? prim.GetMaster() : prim.GetPrimInMaster();
-        GT_PrimitiveHandle instancePrim = 
-                m_cache.GetPrim( masterPrim,
-                                 time, 
-                                 purposes,
-                                 true );
-
-        if( !instancePrim ) {
-            return NULL;
-        }
-        return new CacheEntry( instancePrim );
-    }
-    else if( prim.IsA<UsdGeomBoundable>() )
+    if( prim.IsA<UsdGeomBoundable>() )
     {
         UsdGeomImageable imageable( prim );
 
@@ -59,12 +59,42 @@ public:
                                 GusdPurposeSet purposes,
                                 bool skipRoot = false );
 
+    /// Queue background refinement of \p usdPrim at the frames that follow
+    /// \p time, so that during playback the next frames are already in the
+    /// cache by the time they are drawn.
+    ///
+    /// Prefetching is controlled by GUSD_GT_PRIMCACHE_PREFETCH_FRAMES and is
+    /// disabled by default. Prims that can't be time varying are skipped,
+    /// nothing is prefetched while the cache is close to its memory cap,
+    /// and pending requests are dropped as soon as a request for a frame
+    /// that doesn't follow the previous one requested for the same prim
+    /// indicates that the user is scrubbing rather than playing. Requests
+    /// are dropped while too many are pending. The background thread reads
+    /// stages while holding a GusdStageCacheReader, so stages being read
+    /// aren't cleared or reloaded by cache writers.
+    GUSD_API
+    void    Prefetch( const UsdPrim &usdPrim,
+                      UsdTimeCode time,
+                      GusdPurposeSet purposes );
+
+    /// Drop all pending prefetch requests.
+    GUSD_API
+    void    CancelPrefetch();
+
+    /// Returns true if the cache has room left for prefetched prims.
+    bool    HasPrefetchBudget() const;
+
     void    Clear() override;
     int64   Clear(const UT_StringSet& paths) override;
 
+    const char* GetName() const override { return "GT Primitive Cache"; }
+
+    int64   GetMemoryUsage() const override
+            { return _prims.GetMemoryUsage(); }
+
 private:
 
-    GusdUT_CappedCache _prims;
+    GusdUT_ShardedCappedCache _prims;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
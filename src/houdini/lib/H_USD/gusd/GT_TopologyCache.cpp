@@ -0,0 +1,160 @@
+//
+// Copyright 2017 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#include "gusd/GT_TopologyCache.h"
+
+#include "gusd/GT_VtArray.h"
+
+#include "pxr/base/tf/hash.h"
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+
+GusdGT_TopologyCache::_Key::_Key(
+    const UsdPrim& prim,
+    const TfToken& name,
+    bool timeVarying,
+    size_t valueHash)
+    : prim(prim), name(name), timeVarying(timeVarying), valueHash(valueHash)
+{
+    hash = hash_value(prim);
+    BOOST_NS::hash_combine(hash, name);
+    BOOST_NS::hash_combine(hash, timeVarying);
+    BOOST_NS::hash_combine(hash, valueHash);
+}
+
+
+GusdGT_TopologyCache::GusdGT_TopologyCache(GusdStageCache& cache)
+  : GusdUSD_DataCache(cache),
+    _entries(GUSDUT_USDCACHE_NAME, 256)
+{
+    _TrackStageChanges();
+}
+
+
+GusdGT_TopologyCache::GusdGT_TopologyCache()
+  : GusdGT_TopologyCache(GusdStageCache::GetInstance())
+{}
+
+
+GusdGT_TopologyCache&
+GusdGT_TopologyCache::GetInstance()
+{
+    static GusdGT_TopologyCache cache;
+    return cache;
+}
+
+
+namespace {
+
+size_t
+_HashValue(const VtIntArray& value)
+{
+    size_t h = value.size();
+    for(const int v : value)
+        BOOST_NS::hash_combine(h, v);
+    return h;
+}
+
+} /*namespace*/
+
+
+GT_DataArrayHandle
+GusdGT_TopologyCache::GetIntArray(const UsdAttribute& attr,
+                                  UsdTimeCode time,
+                                  VtIntArray& value)
+{
+    if(!attr)
+        return GT_DataArrayHandle();
+
+    if(!attr.ValueMightBeTimeVarying()) {
+        // The value is the same at all times, so the key doesn't need to
+        // include it, and a hit saves reading it.
+        const _CappedKey key(_Key(attr.GetPrim(), attr.GetName(), false, 0));
+        if(auto entry = _entries.Find<_Entry>(key)) {
+            value = entry->value;
+            return entry->array;
+        }
+        if(!attr.Get(&value, time))
+            return GT_DataArrayHandle();
+
+        GT_DataArrayHandle array(new GusdGT_VtArray<int32>(value));
+        _entries.addItem(key, UT_CappedItemHandle(new _Entry(value, array)));
+        return array;
+    }
+
+    if(!attr.Get(&value, time))
+        return GT_DataArrayHandle();
+
+    const _CappedKey key(_Key(attr.GetPrim(), attr.GetName(),
+                              true, _HashValue(value)));
+    if(auto entry = _entries.Find<_Entry>(key)) {
+        // Guard against hash collisions.
+        if(entry->value == value) {
+            value = entry->value;
+            return entry->array;
+        }
+        return GT_DataArrayHandle(new GusdGT_VtArray<int32>(value));
+    }
+
+    GT_DataArrayHandle array(new GusdGT_VtArray<int32>(value));
+    _entries.addItem(key, UT_CappedItemHandle(new _Entry(value, array)));
+    return array;
+}
+
+
+void
+GusdGT_TopologyCache::Clear()
+{
+    _entries.clear();
+}
+
+
+int64
+GusdGT_TopologyCache::Clear(const UT_StringSet& paths)
+{
+    return _entries.ClearEntries(
+        [&](const UT_CappedKeyHandle& key,
+            const UT_CappedItemHandle& item) {
+
+        const auto& k = *UTverify_cast<const _CappedKey*>(key.get());
+        return ShouldClearPrim(k->prim, paths);
+    });
+}
+
+
+int64
+GusdGT_TopologyCache::ClearSubtrees(const UsdStagePtr& stage,
+                                    const SdfPathVector& subtrees)
+{
+    return _entries.ClearEntries(
+        [&](const UT_CappedKeyHandle& key,
+            const UT_CappedItemHandle& item) {
+
+        const auto& k = *UTverify_cast<const _CappedKey*>(key.get());
+        return ShouldClearPrim(k->prim, stage, subtrees);
+    });
+}
+
+
+PXR_NAMESPACE_CLOSE_SCOPE
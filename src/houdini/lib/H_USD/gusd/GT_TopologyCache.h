@@ -0,0 +1,134 @@
+//
+// Copyright 2017 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#ifndef __GUSD_GT_TOPOLOGYCACHE_H__
+#define __GUSD_GT_TOPOLOGYCACHE_H__
+
+#include "gusd/api.h"
+
+#include "gusd/USD_DataCache.h"
+#include "gusd/UT_CappedCache.h"
+
+#include <GT/GT_DataArray.h>
+
+#include "pxr/pxr.h"
+#include "pxr/base/vt/array.h"
+#include "pxr/usd/usd/attribute.h"
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/** Cache of GT arrays for integer topology attributes, such as face vertex
+    counts and indices.
+
+    Topology is often static even when points are animated. Returning the
+    same GT_DataArrayHandle for each frame lets GT consumers (and in
+    particular the viewport) recognize that the topology did not change,
+    so that only the points and other varying data are refreshed.
+
+    Attributes that can't vary over time are cached by prim and attribute
+    name, and don't need to be read again. For time varying attributes, the
+    value is read and hashed, and frames that happen to hold the same value
+    still share a single array.*/
+class GusdGT_TopologyCache final : public GusdUSD_DataCache
+{
+public:
+    GUSD_API
+    static GusdGT_TopologyCache&    GetInstance();
+
+    GusdGT_TopologyCache(GusdStageCache& cache);
+    GusdGT_TopologyCache();
+
+    ~GusdGT_TopologyCache() override {}
+
+    /** Read @a attr at @a time into @a value, and return a GT array sharing
+        the value's storage. Returns a null handle if the attribute can't be
+        read.*/
+    GUSD_API
+    GT_DataArrayHandle  GetIntArray(const UsdAttribute& attr,
+                                    UsdTimeCode time,
+                                    VtIntArray& value);
+
+    GUSD_API
+    void    Clear() override;
+
+    GUSD_API
+    int64   Clear(const UT_StringSet& paths) override;
+
+    GUSD_API
+    int64   ClearSubtrees(const UsdStagePtr& stage,
+                          const SdfPathVector& subtrees) override;
+
+    const char* GetName() const override { return "Topology Cache"; }
+
+    int64   GetMemoryUsage() const override
+            { return _entries.getMemoryUsage(); }
+
+private:
+    struct _Key
+    {
+        _Key(const UsdPrim& prim, const TfToken& name,
+             bool timeVarying, size_t valueHash);
+
+        bool                operator==(const _Key& o) const
+                            { return hash == o.hash &&
+                                     prim == o.prim &&
+                                     name == o.name &&
+                                     timeVarying == o.timeVarying &&
+                                     valueHash == o.valueHash; }
+
+        struct HashCmp
+        {
+            static size_t   hash(const _Key& key)
+                            { return key.hash; }
+            static bool     equal(const _Key& a, const _Key& b)
+                            { return a == b; }
+        };
+
+        UsdPrim     prim;
+        TfToken     name;
+        bool        timeVarying;
+        size_t      valueHash;
+        size_t      hash;
+    };
+
+    typedef GusdUT_CappedKey<_Key,_Key::HashCmp>    _CappedKey;
+
+    struct _Entry : public UT_CappedItem
+    {
+        _Entry(const VtIntArray& value, const GT_DataArrayHandle& array)
+            : UT_CappedItem(), value(value), array(array) {}
+        ~_Entry() override {}
+
+        int64   getMemoryUsage() const override
+                { return sizeof(*this) + value.size()*sizeof(int); }
+
+        VtIntArray          value;
+        GT_DataArrayHandle  array;
+    };
+
+    GusdUT_CappedCache  _entries;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // __GUSD_GT_TOPOLOGYCACHE_H__
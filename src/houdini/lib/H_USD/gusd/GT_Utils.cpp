@@ -303,6 +303,75 @@ bool _IsNumeric(GT_Storage storage)
 }
 
 
+/// GT storage type whose elements can be reinterpreted as \p T.
+template <typename T> struct _GTStorageOf
+{ static const GT_Storage value = GT_STORE_INVALID; };
+
+template <> struct _GTStorageOf<uint8>
+{ static const GT_Storage value = GT_STORE_UINT8; };
+template <> struct _GTStorageOf<int32>
+{ static const GT_Storage value = GT_STORE_INT32; };
+template <> struct _GTStorageOf<int64>
+{ static const GT_Storage value = GT_STORE_INT64; };
+template <> struct _GTStorageOf<fpreal32>
+{ static const GT_Storage value = GT_STORE_REAL32; };
+template <> struct _GTStorageOf<fpreal64>
+{ static const GT_Storage value = GT_STORE_REAL64; };
+
+
+/// Foreign data source that lets a VtArray reference the storage of a GT
+/// data array, holding a reference to the array for as long as any VtArray
+/// uses its data.
+class _GTArrayForeignSource : public Vt_ArrayForeignDataSource
+{
+public:
+    _GTArrayForeignSource(const GT_DataArrayHandle& data)
+        : Vt_ArrayForeignDataSource(_Detached), _data(data) {}
+
+private:
+    static void _Detached(Vt_ArrayForeignDataSource* self)
+    {
+        delete static_cast<_GTArrayForeignSource*>(self);
+    }
+
+    GT_DataArrayHandle  _data;
+};
+
+
+/// Point \p usdArray at the storage of \p gtData without copying, if the
+/// GT array holds contiguous elements of exactly the USD scalar type.
+/// Large arrays like P, N and uv are often stored this way.
+template <class UsdType>
+bool _WrapArray(VtArray<UsdType>& usdArray, const GT_DataArrayHandle& gtData)
+{
+    using ScalarType = typename GusdPodTupleTraits<UsdType>::ValueType;
+
+    static_assert(sizeof(UsdType) ==
+                  sizeof(ScalarType) * GusdGetTupleSize<UsdType>(),
+                  "USD type must be a packed tuple of its scalar type");
+
+    if (_GTStorageOf<ScalarType>::value == GT_STORE_INVALID ||
+        gtData->getStorage() != _GTStorageOf<ScalarType>::value ||
+        gtData->entries() == 0) {
+        return false;
+    }
+
+    // getArray() returns a pointer to the array's own storage if it has
+    // any, or fills in a new buffer that we can take ownership of instead.
+    GT_DataArrayHandle buffer;
+    const ScalarType* data = gtData->getArray<ScalarType>(buffer);
+    if (!data) {
+        return false;
+    }
+
+    usdArray = VtArray<UsdType>(
+        new _GTArrayForeignSource(buffer ? buffer : gtData),
+        reinterpret_cast<UsdType*>(SYSconst_cast(data)),
+        gtData->entries());
+    return true;
+}
+
+
 /// Convert numeric GT types to USD.
 /// This converter can only be used on types supported directly by the
 /// GT_DataArray interface.
@@ -334,6 +403,10 @@ struct _ConvertNumericToUsd
         if (_IsNumeric(gtData->getStorage()) &&
             gtData->getTupleSize() == tupleSize) {
 
+            if (_WrapArray(usdArray, gtData)) {
+                return true;
+            }
+
             usdArray.resize(gtData->entries());
             auto* dst = reinterpret_cast<ScalarType*>(usdArray.data());
             gtData->fillArray(dst, 0, gtData->entries(), tupleSize);
@@ -427,6 +500,17 @@ private:
     {
         const GT_Size numElems = gtData->entries();
         usdArray.resize(numElems);
+
+        // Convert from contiguous GT storage in bulk, rather than
+        // importing each element separately.
+        GT_DataArrayHandle buffer;
+        if (const GtType* src = gtData->getArray<GtType>(buffer)) {
+            GusdUT_Gf::ConvertScalars(
+                src, reinterpret_cast<ScalarType*>(usdArray.data()),
+                numElems*tupleSize);
+            return true;
+        }
+
         auto dst = TfMakeSpan(usdArray);
         for (GT_Offset i = 0; i < numElems; ++i) {
             _fillValue<GtType>(dst[i], gtData, i);
@@ -464,6 +548,23 @@ struct _ConvertQuatToUsd
         if (GTisFloat(gtData->getStorage()) && gtData->getTupleSize() == 4) {
 
             usdArray.resize(gtData->entries());
+
+            // GfQuat stores its imaginary components before the real one,
+            // matching Houdini's i,j,k,w ordering, so the whole array can be
+            // converted as flat scalars.
+            static_assert(sizeof(UsdType) == sizeof(GtScalarType)*4,
+                          "Unexpected quaternion layout");
+            using GtReadType = typename std::conditional<
+                SYSisSame<GtScalarType,double>(), fpreal64, fpreal32>::type;
+            GT_DataArrayHandle buffer;
+            if (const GtReadType* src =
+                    gtData->getArray<GtReadType>(buffer)) {
+                GusdUT_Gf::ConvertScalars(
+                    src, reinterpret_cast<GtScalarType*>(usdArray.data()),
+                    gtData->entries()*4);
+                return true;
+            }
+
             auto dst = TfMakeSpan(usdArray);
             for (GT_Offset i = 0; i < gtData->entries(); ++i) {
                 _fillValue(dst[i], gtData, i);
@@ -73,6 +73,7 @@
 #include <GU/GU_PrimPacked.h>
 #include <UT/UT_DMatrix4.h>
 #include <UT/UT_Map.h>
+#include <UT/UT_ParallelUtil.h>
 #include <SYS/SYS_TypeTraits.h>
 
 #include <mutex>
@@ -148,39 +149,15 @@ public:
 };
 
 static UsdPackedFactory *theFactory = NULL;
-const char* k_typeName = "PackedUSD";
-
-} // close namespace 
-
-GusdPackedUSDTracker GusdGU_PackedUSD::thePackedUSDTracker;
 
+/// Copy the authored primvars of non-boundable prims to primitive attributes
+/// of the packed prim.
 void
-GusdGU_PackedUSD::setPackedUSDTracker(GusdPackedUSDTracker tracker)
+copyPrimvarsToAttributes( GU_Detail& detail,
+                          GU_PrimPacked* packedPrim,
+                          const UsdPrim& prim,
+                          UsdTimeCode frame )
 {
-    // This callback should only be set once.
-    UT_ASSERT(!thePackedUSDTracker);
-    thePackedUSDTracker = tracker;
-}
-
-/* static */
-GU_PrimPacked* 
-GusdGU_PackedUSD::Build( 
-    GU_Detail&              detail, 
-    const UT_StringHolder&  fileName, 
-    const SdfPath&          primPath, 
-    UsdTimeCode             frame, 
-    const char*             lod,
-    GusdPurposeSet          purposes,
-    const UsdPrim&          prim,
-    const UT_Matrix4D*      xform,
-    PivotLocation           pivotloc )
-{   
-    auto packedPrim = GU_PrimPacked::build( detail, k_typeName );
-    auto impl = UTverify_cast<GusdGU_PackedUSD *>(packedPrim->hardenImplementation());
-    impl->m_fileName = fileName;
-    impl->m_primPath = primPath;
-    impl->m_frame = frame;
-
     if( prim && !prim.IsA<UsdGeomBoundable>() )
     {
         UsdGeomImageable geom = UsdGeomImageable(prim);
@@ -219,6 +196,42 @@ GusdGU_PackedUSD::Build(
             }
         }
     }
+}
+
+const char* k_typeName = "PackedUSD";
+
+} // close namespace 
+
+GusdPackedUSDTracker GusdGU_PackedUSD::thePackedUSDTracker;
+
+void
+GusdGU_PackedUSD::setPackedUSDTracker(GusdPackedUSDTracker tracker)
+{
+    // This callback should only be set once.
+    UT_ASSERT(!thePackedUSDTracker);
+    thePackedUSDTracker = tracker;
+}
+
+/* static */
+GU_PrimPacked* 
+GusdGU_PackedUSD::Build( 
+    GU_Detail&              detail, 
+    const UT_StringHolder&  fileName, 
+    const SdfPath&          primPath, 
+    UsdTimeCode             frame, 
+    const char*             lod,
+    GusdPurposeSet          purposes,
+    const UsdPrim&          prim,
+    const UT_Matrix4D*      xform,
+    PivotLocation           pivotloc )
+{   
+    auto packedPrim = GU_PrimPacked::build( detail, k_typeName );
+    auto impl = UTverify_cast<GusdGU_PackedUSD *>(packedPrim->hardenImplementation());
+    impl->m_fileName = fileName;
+    impl->m_primPath = primPath;
+    impl->m_frame = frame;
+
+    copyPrimvarsToAttributes( detail, packedPrim, prim, frame );
 
     if( lod )
     {
@@ -319,10 +332,178 @@ GusdGU_PackedUSD::Build(
 }
 
 
+/* static */
+void
+GusdGU_PackedUSD::BuildMany(
+    GU_Detail&                                  detail,
+    const UT_Array<UT_StringHolder>&            fileNames,
+    const UT_Array<SdfPath>&                    primPaths,
+    const UT_Array<UsdPrim>&                    prims,
+    const GusdDefaultArray<UsdTimeCode>&        frames,
+    const GusdDefaultArray<UT_StringHolder>&    lods,
+    const GusdDefaultArray<GusdPurposeSet>&     purposes,
+    PivotLocation                               pivotloc,
+    UT_Array<GU_PrimPacked*>*                   built )
+{
+    UT_ASSERT(fileNames.size() == prims.size());
+    UT_ASSERT(primPaths.size() == prims.size());
+
+    const exint n = prims.size();
+    UT_Array<GU_PrimPacked*> packedPrims(n, n);
+    UT_Array<GusdGU_PackedUSD*> impls(n, n);
+
+    // Creating prims and attributes modifies the detail, so that has to
+    // happen serially. Since the prims are new, we can set the intrinsics
+    // directly rather than going through the setters, which dirty the prim
+    // and reset caches on every call.
+    for( exint i = 0; i < n; ++i ) {
+        auto packedPrim = GU_PrimPacked::build( detail, k_typeName );
+        auto impl = UTverify_cast<GusdGU_PackedUSD *>(
+            packedPrim->hardenImplementation());
+
+        // It seems that Houdini may reuse memory for packed implementations
+        // with out calling the constructor to initialize data. 
+        impl->resetCaches();
+
+        impl->m_fileName = fileNames(i);
+        impl->m_primPath = primPaths(i);
+        impl->m_frame = frames(i);
+        impl->m_purposes = purposes(i);
+        impl->m_usdPrim = prims(i);
+
+        copyPrimvarsToAttributes( detail, packedPrim, prims(i), frames(i) );
+
+        if( const char* lod = lods(i) ) {
+            impl->intrinsicSetViewportLOD( packedPrim, lod );
+        }
+        packedPrim->topologyDirty();
+        impl->updateTransform( packedPrim );
+
+        if (thePackedUSDTracker)
+            thePackedUSDTracker(impl, true);
+
+        packedPrims(i) = packedPrim;
+        impls(i) = impl;
+    }
+
+    // The pivots require the USD transforms, and possibly the bounds, which
+    // is where most of the time goes. Each implementation is only touched by
+    // a single thread, and the thread-safe USD caches do the rest.
+    UT_Array<UT_Vector3> pivots(n, n);
+    UT_Array<bool> hasPivot(n, n);
+    UTparallelForLightItems(UT_BlockedRange<exint>(0, n),
+        [&](const UT_BlockedRange<exint>& r) {
+            for( exint i = r.begin(); i < r.end(); ++i ) {
+                hasPivot(i) = impls(i)->computePivot(pivotloc, pivots(i));
+            }
+        });
+
+    // Setting P writes to the detail, so go back to serial.
+    for( exint i = 0; i < n; ++i ) {
+        if( hasPivot(i) ) {
+            GU_PrimPacked* packedPrim = packedPrims(i);
+            packedPrim->setPivot(pivots(i));
+            packedPrim->setPos3(0, pivots(i) + packedPrim->getPos3(0));
+        }
+    }
+
+    if( built ) {
+        built->concat(packedPrims);
+    }
+}
+
+
+/* static */
+void
+GusdGU_PackedUSD::UpdateMany(
+    GU_Detail&                                  detail,
+    const UT_Array<GU_PrimPacked*>&             packedPrims,
+    const GusdDefaultArray<UT_StringHolder>&    fileNames,
+    const UT_Array<UsdPrim>&                    prims,
+    const GusdDefaultArray<UsdTimeCode>&        frames,
+    const GusdDefaultArray<UT_StringHolder>&    lods,
+    const GusdDefaultArray<GusdPurposeSet>&     purposes,
+    PivotLocation                               pivotloc,
+    const UT_Matrix4D*                          xforms )
+{
+    UT_ASSERT(packedPrims.size() == prims.size());
+
+    const exint n = packedPrims.size();
+    UT_Array<GusdGU_PackedUSD*> impls(n, n);
+
+    // Put each prim back into the state Build() leaves it in before the
+    // pivot is set, at the new frame. This modifies the detail, so it has to
+    // happen serially.
+    for( exint i = 0; i < n; ++i ) {
+        GU_PrimPacked* packedPrim = packedPrims(i);
+        auto impl = UTverify_cast<GusdGU_PackedUSD *>(
+            packedPrim->hardenImplementation());
+
+        packedPrim->setLocalTransform(UT_Matrix3D(1.0));
+        packedPrim->setPivot(UT_Vector3(0, 0, 0));
+        packedPrim->setPos3(0, UT_Vector3(0, 0, 0));
+
+        // The stage may have changed even if the frame didn't, so always
+        // reset the caches. A new file name means the prim has to be
+        // registered again, as in setFileName().
+        const bool newFileName = (fileNames(i) != impl->m_fileName);
+        if( newFileName && thePackedUSDTracker )
+            thePackedUSDTracker(impl, false);
+
+        impl->resetCaches();
+        impl->m_fileName = fileNames(i);
+        impl->m_frame = frames(i);
+        impl->m_purposes = purposes(i);
+        impl->m_usdPrim = prims(i);
+
+        // A prim built without a LOD has the default one.
+        if( const char* lod = lods(i) ) {
+            impl->intrinsicSetViewportLOD( packedPrim, lod );
+        } else {
+            packedPrim->setViewportLOD( GEO_VIEWPORT_FULL );
+        }
+        packedPrim->topologyDirty();
+        impl->updateTransform( packedPrim );
+
+        if( newFileName && thePackedUSDTracker )
+            thePackedUSDTracker(impl, true);
+
+        copyPrimvarsToAttributes( detail, packedPrim, prims(i), frames(i) );
+
+        impls(i) = impl;
+    }
+
+    // As in BuildMany(), the pivots are where most of the time goes.
+    UT_Array<UT_Vector3> pivots(n, n);
+    UT_Array<bool> hasPivot(n, n);
+    UTparallelForLightItems(UT_BlockedRange<exint>(0, n),
+        [&](const UT_BlockedRange<exint>& r) {
+            for( exint i = r.begin(); i < r.end(); ++i ) {
+                hasPivot(i) = impls(i)->computePivot(pivotloc, pivots(i));
+            }
+        });
+
+    for( exint i = 0; i < n; ++i ) {
+        GU_PrimPacked* packedPrim = packedPrims(i);
+        if( hasPivot(i) ) {
+            packedPrim->setPivot(pivots(i));
+            packedPrim->setPos3(0, pivots(i) + packedPrim->getPos3(0));
+        }
+
+        // Same as GusdGU_USD::SetPackedPrimTransforms()
+        const UT_Matrix4D &m = xforms[i];
+        packedPrim->setLocalTransform(
+            packedPrim->localTransform() * UT_Matrix3D(m));
+        packedPrim->setPos3(0, packedPrim->getPos3(0) * m);
+    }
+}
+
+
 GusdGU_PackedUSD::GusdGU_PackedUSD()
     : GU_PackedImpl()
     , m_transformCacheValid(false)
     , m_masterPathCacheValid(false)
+    , m_instanceKeyValid(false)
     , m_index(-1)
     , m_frame(std::numeric_limits<float>::min())
     , m_purposes( GusdPurposeSet( GUSD_PURPOSE_DEFAULT | GUSD_PURPOSE_PROXY ))
@@ -343,6 +524,8 @@ GusdGU_PackedUSD::GusdGU_PackedUSD( const GusdGU_PackedUSD &src )
     , m_transformCache( src.m_transformCache )
     , m_masterPathCacheValid( src.m_masterPathCacheValid )
     , m_masterPathCache( src.m_masterPathCache )
+    , m_instanceKeyValid( src.m_instanceKeyValid )
+    , m_instanceKey( src.m_instanceKey )
     , m_gtPrimCache( NULL )
 {
     // Register this new packed USD prim if m_usdPrim has already been set.
@@ -388,6 +571,7 @@ GusdGU_PackedUSD::resetCaches()
     m_usdPrim = UsdPrim();
     m_transformCacheValid = false;
     m_gtPrimCache = GT_PrimitiveHandle();
+    m_instanceKeyValid = false;
 }
 
 void
@@ -412,20 +596,16 @@ GusdGU_PackedUSD::setTransform( GU_PrimPacked* prim, const UT_Matrix4D& mx )
     prim->setPos3(0, pivot * xform);
 }
 
-void
-GusdGU_PackedUSD::initializePivot(GU_PrimPacked *prim, PivotLocation pivotloc)
+bool
+GusdGU_PackedUSD::computePivot(PivotLocation pivotloc, UT_Vector3 &pivot) const
 {
     switch (pivotloc)
     {
     case PivotLocation::Origin:
     {
         // Place at the origin of the coordinate frame.
-        UT_Vector3 pivot;
         getUsdTransform().getTranslates(pivot);
-
-        prim->setPivot(pivot);
-        prim->setPos3(0, pivot + prim->getPos3(0));
-        break;
+        return true;
     }
 
     case PivotLocation::Centroid:
@@ -435,14 +615,24 @@ GusdGU_PackedUSD::initializePivot(GU_PrimPacked *prim, PivotLocation pivotloc)
         {
             // getBounds() returns the untransformed bounds, so transform the
             // center to world space.
-            const UT_Vector3 pivot = bbox.center() * getUsdTransform();
-
-            prim->setPivot(pivot);
-            prim->setPos3(0, pivot + prim->getPos3(0));
+            pivot = bbox.center() * getUsdTransform();
+            return true;
         }
         break;
     }
     }
+    return false;
+}
+
+void
+GusdGU_PackedUSD::initializePivot(GU_PrimPacked *prim, PivotLocation pivotloc)
+{
+    UT_Vector3 pivot;
+    if (computePivot(pivotloc, pivot))
+    {
+        prim->setPivot(pivot);
+        prim->setPos3(0, pivot + prim->getPos3(0));
+    }
 }
 
 void
@@ -752,6 +942,19 @@ GusdGU_PackedUSD::save(UT_Options &options, const GA_SaveMap &map) const
 bool
 GusdGU_PackedUSD::getBounds(UT_BoundingBox &box) const
 {
+    GusdBoundsCache& boundsCache = GusdBoundsCache::GetInstance();
+
+    // Check the persistent bounds cache before opening the stage, so
+    // unloaded prims can be displayed without composing their stage.
+    const bool usePersistent = !m_usdPrim &&
+        GusdBoundsCache::IsPersistentCacheEnabled();
+    if( usePersistent &&
+        boundsCache.FindPersistentBound(
+            m_fileName, m_primPath, UsdTimeCode( m_frame ),
+            GusdPurposeSetToTokens(m_purposes), box )) {
+        return true;
+    }
+
     UsdPrim prim = getUsdPrim();
 
     if( !prim ) {
@@ -762,11 +965,16 @@ GusdGU_PackedUSD::getBounds(UT_BoundingBox &box) const
     {
         TfTokenVector purposes = GusdPurposeSetToTokens(m_purposes);
 
-        if ( GusdBoundsCache::GetInstance().ComputeUntransformedBound(
+        if ( boundsCache.ComputeUntransformedBound(
                 prim,
                 UsdTimeCode( m_frame ),
                 purposes,
                 box )) {
+            if( usePersistent ) {
+                boundsCache.AddPersistentBound(
+                    m_fileName, m_primPath, UsdTimeCode( m_frame ),
+                    purposes, box );
+            }
             return true;
         }
     }
@@ -1069,6 +1277,7 @@ GusdGU_PackedUSD::mergeGeometry(GU_Detail &destgdp,
         destgdp, details);
 
     UT_Array<GU_Detail *> gdps;
+    gdps.setCapacity(details.entries());
     for (GU_DetailHandle &gdh : details)
     {
         UT_ASSERT(gdh.isValid());
@@ -1216,6 +1425,41 @@ GusdGU_PackedUSD::getInstanceKey(UT_Options& key) const
     return true;
 }
 
+const GusdGU_PackedUSDInstanceKey&
+GusdGU_PackedUSD::getInstanceKey() const
+{
+    if( m_instanceKeyValid )
+        return m_instanceKey;
+
+    GusdGU_PackedUSDInstanceKey key;
+    key.fileName = m_fileName;
+    key.primPath = m_primPath;
+    key.time = GusdUSD_Utils::GetNumericTime(m_frame);
+    key.purposes = m_purposes;
+
+    UsdPrim usdPrim = getUsdPrim();
+    if( usdPrim ) {
+        // If this prim is an instance, use the master's path so that
+        // instances can share GT prims.
+        if( usdPrim.IsInstance() ) {
+            key.stage = get_pointer(usdPrim.GetStage());
+            key.primPath = usdPrim.GetMaster().GetPrimPath();
+        }
+        else if( usdPrim.IsInstanceProxy() ) {
+            key.stage = get_pointer(usdPrim.GetStage());
+            key.primPath = usdPrim.GetPrimInMaster().GetPrimPath();
+        }
+    }
+    key.hash = key.ComputeHash();
+
+    // Only cache the key once the prim has been found, like the master
+    // path cache, so a stage that fails to load now is checked again.
+    m_instanceKey = key;
+    m_instanceKeyValid = bool(usdPrim);
+
+    return m_instanceKey;
+}
+
 int64 
 GusdGU_PackedUSD::getMemoryUsage(bool inclusive) const
 {
@@ -1247,6 +1491,7 @@ GusdGU_PackedUSD::getUsdPrim(UT_ErrorSeverity sev) const
         return m_usdPrim;
 
     m_masterPathCacheValid = false;
+    m_instanceKeyValid = false;
 
     SdfPath primPathWithoutVariants;
     GusdStageEditPtr edit;
@@ -1272,10 +1517,14 @@ GusdGU_PackedUSD::fullGT() const
         return m_gtPrimCache;
 
     if(UsdPrim usdPrim = getUsdPrim()) {
-        m_gtPrimCache = GusdGT_PrimCache::GetInstance().GetPrim( 
+        GusdGT_PrimCache &cache = GusdGT_PrimCache::GetInstance();
+        m_gtPrimCache = cache.GetPrim( 
                             m_usdPrim, 
                             m_frame,
                             m_purposes );
+
+        // Start on the frames that are likely to be drawn next.
+        cache.Prefetch( m_usdPrim, m_frame, m_purposes );
     }
     return m_gtPrimCache;
 }
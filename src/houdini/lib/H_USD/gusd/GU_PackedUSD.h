@@ -29,10 +29,13 @@
 #include <GU/GU_PackedImpl.h>
 #include <GT/GT_Handles.h>
 #include <UT/UT_Error.h>
+#include <UT/UT_StringHolder.h>
+#include <SYS/SYS_Hash.h>
 
 #include <pxr/pxr.h>
 #include "pxr/usd/usd/prim.h"
 #include "pxr/usd/usdGeom/imageable.h"
+#include "gusd/defaultArray.h"
 #include "gusd/purpose.h"
 #include "gusd/stageEdit.h"
 #include "gusd/USD_Utils.h"
@@ -67,6 +70,47 @@ PXR_NAMESPACE_OPEN_SCOPE
 
 typedef void (*GusdPackedUSDTracker)(const GU_PackedImpl *prim, bool create);
 
+/// Identifies the packed USD prims that can share a GT prim as instances.
+/// Instances and instance proxies are identified by their master prim, along
+/// with the stage it was found on, since masters on different stages can
+/// have the same path. The hash is computed once, so comparing keys doesn't
+/// require any string operations beyond comparing the file names.
+struct GusdGU_PackedUSDInstanceKey
+{
+    GusdGU_PackedUSDInstanceKey()
+        : stage(nullptr), time(0), purposes(0), hash(0) {}
+
+    std::size_t         ComputeHash() const
+                        {
+                            std::size_t h = fileName.hash();
+                            SYShashCombine(h, stage);
+                            SYShashCombine(h, primPath.GetHash());
+                            SYShashCombine(h, time);
+                            SYShashCombine(h, purposes);
+                            return h;
+                        }
+
+    bool                operator==(const GusdGU_PackedUSDInstanceKey& o) const
+                        {
+                            return hash == o.hash &&
+                                   primPath == o.primPath &&
+                                   stage == o.stage &&
+                                   time == o.time &&
+                                   purposes == o.purposes &&
+                                   fileName == o.fileName;
+                        }
+
+    friend size_t       hash_value(const GusdGU_PackedUSDInstanceKey& o)
+                        { return o.hash; }
+
+    UT_StringHolder     fileName;
+    const void*         stage;
+    SdfPath             primPath;
+    fpreal64            time;
+    int                 purposes;
+    std::size_t         hash;
+};
+
 class GusdGU_PackedUSD : public GU_PackedImpl
 {
 public:
@@ -110,6 +154,42 @@ public:
                             const UT_Matrix4D*      xform = nullptr,
                             PivotLocation           pivotloc = PivotLocation::Origin);
 
+    /// Build a packed USD prim for each of \p prims, with the file name
+    /// and prim path given by \p fileNames and \p primPaths. All prims must
+    /// be valid.
+    /// This is equivalent to calling Build() for each prim, but skips the
+    /// per-prim intrinsic updates and computes the pivots in parallel. Pass
+    /// the same UT_StringHolder for prims that share a file to avoid
+    /// duplicating the name. If \p built is non-null, the new prims are
+    /// appended to it.
+    static void BuildMany(
+                            GU_Detail&                              detail,
+                            const UT_Array<UT_StringHolder>&        fileNames,
+                            const UT_Array<SdfPath>&                primPaths,
+                            const UT_Array<UsdPrim>&                prims,
+                            const GusdDefaultArray<UsdTimeCode>&    frames,
+                            const GusdDefaultArray<UT_StringHolder>& lods,
+                            const GusdDefaultArray<GusdPurposeSet>& purposes,
+                            PivotLocation       pivotloc = PivotLocation::Origin,
+                            UT_Array<GU_PrimPacked*>* built = nullptr);
+
+    /// Move packed USD prims previously built for \p prims to \p frames.
+    /// This reapplies \p fileNames, \p lods and \p purposes, recomputes
+    /// the primvar attributes and pivots (the pivots in parallel), then
+    /// applies \p xforms on top of the USD transforms, in the same way the
+    /// prims are set up when they are built. This is equivalent to building
+    /// the prims again, but keeps the existing prims.
+    static void UpdateMany(
+                            GU_Detail&                              detail,
+                            const UT_Array<GU_PrimPacked*>&         packedPrims,
+                            const GusdDefaultArray<UT_StringHolder>& fileNames,
+                            const UT_Array<UsdPrim>&                prims,
+                            const GusdDefaultArray<UsdTimeCode>&    frames,
+                            const GusdDefaultArray<UT_StringHolder>& lods,
+                            const GusdDefaultArray<GusdPurposeSet>& purposes,
+                            PivotLocation                           pivotloc,
+                            const UT_Matrix4D*                      xforms);
+
     GusdGU_PackedUSD();
     GusdGU_PackedUSD(const GusdGU_PackedUSD &src );
     ~GusdGU_PackedUSD() override;
@@ -243,6 +323,11 @@ public:
 
     // Return a structure that can be hashed to sort instances by prototype.
     bool getInstanceKey(UT_Options& key) const;
+
+    /// Return the key used to sort instances by prototype. This is computed
+    /// once and cached, so it is much cheaper than building and comparing
+    /// the UT_Options version.
+    const GusdGU_PackedUSDInstanceKey& getInstanceKey() const;
     
     /// Report memory usage (includes all shared memory)
     int64 getMemoryUsage(bool inclusive) const override;
@@ -303,6 +388,7 @@ private:
     void resetCaches();
     void updateTransform( GU_PrimPacked* prim );
     void initializePivot(GU_PrimPacked *prim, PivotLocation pivotloc);
+    bool computePivot(PivotLocation pivotloc, UT_Vector3 &pivot) const;
 
     /// Set the overall world transform. This will set the 'transform'
     /// intrinsic and P so that this transform is produced when combined with
@@ -325,6 +411,8 @@ private:
     mutable GT_PrimitiveHandle  m_gtPrimCache;
     mutable bool                m_masterPathCacheValid;
     mutable std::string         m_masterPathCache;
+    mutable bool                m_instanceKeyValid;
+    mutable GusdGU_PackedUSDInstanceKey m_instanceKey;
 
     // static
     static GusdPackedUSDTracker thePackedUSDTracker;
@@ -446,9 +446,7 @@ GusdGU_USD::BindPrimsFromAttrs(
         UT_Array<GusdStageEditPtr> uniqueEdits;
         uniqueEdits.setSize(uniqueVariants.size());
         for(exint i = 0; i < uniqueVariants.size(); ++i) {
-            GusdStageEdit* edit = new GusdStageEdit;
-            edit->GetVariants().append(uniqueVariants(i));
-            uniqueEdits(i).reset(edit);
+            uniqueEdits(i) = GusdStageEdit::GetVariantsEdit(uniqueVariants(i));
         }
 
         // Expand out the edit array.    
@@ -660,11 +658,44 @@ GusdGU_USD::AppendPackedPrims(
     UT_ASSERT(lods.IsConstant() || lods.size() == prims.size());
     UT_ASSERT(purposes.IsConstant() || purposes.size() == prims.size());
 
+    // Prims without a registered build function are collected into batches
+    // for GusdGU_PackedUSD::BuildMany(). A batch is flushed whenever a prim
+    // needs a build function, so the prims are appended in order.
+    UT_Array<UT_StringHolder> batchFileNames;
+    UT_Array<SdfPath> batchPaths;
+    UT_Array<UsdPrim> batchPrims;
+    GusdDefaultArray<UsdTimeCode> batchTimes(times.GetDefault());
+    GusdDefaultArray<UT_StringHolder> batchLods(lods.GetDefault());
+    GusdDefaultArray<GusdPurposeSet> batchPurposes(purposes.GetDefault());
+
+    const auto flushBatch = [&]() {
+        if (batchPrims.isEmpty()) {
+            return;
+        }
+        GusdGU_PackedUSD::BuildMany(gd, batchFileNames, batchPaths,
+                                    batchPrims, batchTimes, batchLods,
+                                    batchPurposes, pivotloc);
+        batchFileNames.clear();
+        batchPaths.clear();
+        batchPrims.clear();
+        batchTimes.Clear();
+        batchLods.Clear();
+        batchPurposes.Clear();
+    };
+
+    // Prims usually come from a handful of stages, so share the file name
+    // holders between them rather than creating one per prim.
+    UsdStageWeakPtr lastStage;
+    UT_StringHolder lastFileName;
+
     for (exint i = 0; i < prims.size(); ++i) {
         if (const UsdPrim& prim = prims(i)) {
 
-            const std::string& usdFileName =
-                prim.GetStage()->GetRootLayer()->GetIdentifier();
+            const UsdStageWeakPtr stage = prim.GetStage();
+            if (stage != lastStage) {
+                lastStage = stage;
+                lastFileName = stage->GetRootLayer()->GetIdentifier();
+            }
 
             SdfPath usdPrimPath = prim.GetPath();
 
@@ -678,16 +709,24 @@ GusdGU_USD::AppendPackedPrims(
             auto it = packedPrimBuildFuncRegistry.find( prim.GetTypeName() );
             if( it != packedPrimBuildFuncRegistry.end() ) {
 
-                (*it->second)( gd, usdFileName, usdPrimPath,
+                flushBatch();
+                (*it->second)( gd, lastFileName.toStdString(), usdPrimPath,
                                times(i), lods(i), purposes(i) );
             }
             else {
-                GusdGU_PackedUSD::Build( gd, usdFileName, usdPrimPath,
-                                         times(i), lods(i), purposes(i), prim,
-                                         nullptr, pivotloc );
+                batchFileNames.append(lastFileName);
+                batchPaths.append(usdPrimPath);
+                batchPrims.append(prim);
+                if (!times.IsConstant())
+                    batchTimes.GetArray().append(times(i));
+                if (!lods.IsConstant())
+                    batchLods.GetArray().append(lods(i));
+                if (!purposes.IsConstant())
+                    batchPurposes.GetArray().append(purposes(i));
             }
         }
     }
+    flushBatch();
 
     return true;
 }
@@ -725,6 +764,86 @@ GusdGU_USD::AppendPackedPrimsFromLopNode(
     return true;
 }
 
+bool
+GusdGU_USD::UpdateExpandedPackedPrimsFromLopNode(
+    GU_Detail& gd,
+    const GA_Detail& srcGd,
+    const GA_Range& srcRng,
+    const UT_Array<PrimIndexPair>& primIndexPairs,
+    const GusdDefaultArray<UsdTimeCode>& times,
+    GusdGU_PackedUSD::PivotLocation pivotloc)
+{
+    UT_AutoInterrupt task("Updating unpacked USD prims");
+
+    const exint srcSize = srcRng.getEntries();
+    const exint dstSize = primIndexPairs.size();
+    if (gd.getNumPrimitives() != dstSize) {
+        return false;
+    }
+
+    // Make sure the prims are the ones built for primIndexPairs before
+    // changing anything.
+    UT_Array<GU_PrimPacked*> packedPrims(dstSize, dstSize);
+    UT_Array<UsdPrim> prims(dstSize, dstSize);
+    exint i = 0;
+    for (GA_Iterator it(gd.getPrimitiveRange()); !it.atEnd(); ++it, ++i) {
+        GEO_Primitive* p = gd.getGEOPrimitive(*it);
+        if (p->getTypeId() != GusdGU_PackedUSD::typeId()) {
+            return false;
+        }
+        auto packedPrim = UTverify_cast<GU_PrimPacked*>(p);
+        auto impl = UTverify_cast<const GusdGU_PackedUSD*>(
+            packedPrim->sharedImplementation());
+
+        prims(i) = primIndexPairs(i).first;
+        if (!prims(i) || impl->primPath() != prims(i).GetPath()) {
+            return false;
+        }
+        packedPrims(i) = packedPrim;
+    }
+
+    GA_OffsetArray indexToOffset;
+    if (!OffsetArrayFromRange(srcRng, indexToOffset)) {
+        return false;
+    }
+
+    UT_Array<UT_Matrix4D> srcXforms(srcSize, srcSize);
+    ComputeTransformsFromPackedPrims(srcGd, indexToOffset,
+                                     srcXforms.array());
+
+    UT_StringArray srcStageIds;
+    srcStageIds.setSize(srcSize);
+    UT_StringArray srcVpLODs;
+    srcVpLODs.setSize(srcSize);
+    UT_Array<GusdPurposeSet> srcPurposes;
+    srcPurposes.setSize(srcSize);
+    GetPackedPrimStageIdsViewportLODsAndPurposes(
+        srcGd, indexToOffset, srcStageIds, srcVpLODs, srcPurposes);
+
+    // Remap to the destination prims, as in
+    // AppendExpandedPackedPrimsFromLopNode().
+    GusdDefaultArray<UT_StringHolder> dstStageIds;
+    dstStageIds.GetArray().setSize(dstSize);
+    UT_Array<UT_Matrix4D> dstXforms(dstSize, dstSize);
+    GusdDefaultArray<UT_StringHolder> dstVpLOD;
+    dstVpLOD.GetArray().setSize(dstSize);
+    GusdDefaultArray<GusdPurposeSet> dstPurposes;
+    dstPurposes.GetArray().setSize(dstSize);
+
+    for (i = 0; i < dstSize; ++i) {
+        const exint srcIdx = primIndexPairs(i).second;
+        dstStageIds.GetArray()(i) = srcStageIds(srcIdx);
+        dstXforms(i) = srcXforms(srcIdx);
+        dstVpLOD.GetArray()(i) = srcVpLODs(srcIdx);
+        dstPurposes.GetArray()(i) = srcPurposes(srcIdx);
+    }
+
+    GusdGU_PackedUSD::UpdateMany(gd, packedPrims, dstStageIds, prims, times,
+                                 dstVpLOD, dstPurposes, pivotloc,
+                                 dstXforms.array());
+    return true;
+}
+
 static UT_StringArray
 gusdFindAttribsToCopy(
         const GA_Detail& detail,
@@ -1057,7 +1176,8 @@ struct Gusd_ConvertPrims
           myPrimvarPattern(primvarPattern),
           myAttribPattern(attributePattern),
           myTranslateSTtoUV(translateSTtoUV),
-          myNonTransformingPrimvarPattern(nonTransformingPrimvarPattern)
+          myNonTransformingPrimvarPattern(nonTransformingPrimvarPattern),
+          myNumPrims(0)
     {
     }
 
@@ -1066,7 +1186,8 @@ struct Gusd_ConvertPrims
           myPrimvarPattern(src.myPrimvarPattern),
           myAttribPattern(src.myAttribPattern),
           myTranslateSTtoUV(src.myTranslateSTtoUV),
-          myNonTransformingPrimvarPattern(src.myNonTransformingPrimvarPattern)
+          myNonTransformingPrimvarPattern(src.myNonTransformingPrimvarPattern),
+          myNumPrims(0)
     {
     }
 
@@ -1100,6 +1221,8 @@ struct Gusd_ConvertPrims
 
             myPrimIndices.appendMultiple(
                 GA_Index(i), myDetails.entries() - start);
+            for (exint j = start, n = myDetails.entries(); j < n; ++j)
+                myNumPrims += myDetails[j].gdp()->getNumPrimitives();
         }
     }
 
@@ -1107,6 +1230,7 @@ struct Gusd_ConvertPrims
     {
         myDetails.concat(other.myDetails);
         myPrimIndices.concat(other.myPrimIndices);
+        myNumPrims += other.myNumPrims;
     }
 
     const GU_Detail &mySrcGdp;
@@ -1117,6 +1241,8 @@ struct Gusd_ConvertPrims
 
     UT_Array<GU_DetailHandle> myDetails;
     UT_Array<GA_Index> myPrimIndices;
+    /// Total number of primitives in myDetails.
+    exint myNumPrims;
 };
 } // namespace
 
@@ -1222,7 +1348,10 @@ GusdGU_USD::AppendExpandedPackedPrimsFromLopNode(
         UTparallelReduce(
             UT_BlockedRange<exint>(start, gdPtr->getNumPrimitives()), task);
 
-        // Build the srcOffsets array.
+        // Build the srcOffsets array. The primitive total was counted while
+        // refining, so the list is sized once up front.
+        srcOffsets.setEntries(task.myNumPrims);
+        exint dst_i = 0;
         for (exint i = 0, n = task.myDetails.entries(); i < n; ++i)
         {
             const GU_DetailHandle &gdh = task.myDetails[i];
@@ -1233,9 +1362,10 @@ GusdGU_USD::AppendExpandedPackedPrimsFromLopNode(
             for (exint j = 0, count = gdh.gdp()->getNumPrimitives(); j < count;
                  ++j)
             {
-                srcOffsets.append(offset);
+                srcOffsets.set(dst_i++, offset);
             }
         }
+        UT_ASSERT(dst_i == task.myNumPrims);
 
         // Merge the details produced from the prims.
         GusdGU_PackedUSD::mergeGeometry(gd, task.myDetails);
@@ -1538,81 +1668,78 @@ GusdGU_USD::CopyAttributes(const GA_Range& srcRng,
 namespace {
 
 
-template <typename ModifyFn>
-struct _ModifyXformsT
+/** Builds transforms from the i/j/k/P attributes, applying pscale and
+    scale if present. All attributes are read in a single pass, so that
+    each matrix is only written once rather than once per attribute.*/
+struct _XformsFromIJKFn
 {
-    _ModifyXformsT(const ModifyFn& modifyFn, const GA_OffsetArray& offsets,
-                   UT_Matrix4D* xforms)
-        : _modifyFn(modifyFn), _offsets(offsets), _xforms(xforms) {}
+    _XformsFromIJKFn(const GA_ROHandleV3& i,
+                     const GA_ROHandleV3& j,
+                     const GA_ROHandleV3& k,
+                     const GA_ROHandleV3& p,
+                     const GA_ROHandleF& pscale,
+                     const GA_ROHandleV3& scale,
+                     const GA_OffsetArray& offsets,
+                     UT_Matrix4D* xforms)
+        : _i(i), _j(j), _k(k), _p(p), _pscale(pscale), _scale(scale),
+          _offsets(offsets), _xforms(xforms) {}
 
     void    operator()(const UT_BlockedRange<size_t>& r) const
             {
                 auto* boss = UTgetInterrupt();
                 char bcnt = 0;
 
-                for(size_t i = r.begin(); i < r.end(); ++i) {
+                const bool hasPScale = _pscale.isValid();
+                const bool hasScale = _scale.isValid();
+
+                for(size_t idx = r.begin(); idx < r.end(); ++idx) {
                     if(ARCH_UNLIKELY(!++bcnt && boss->opInterrupt()))
                         return;
-                    _modifyFn(_xforms[i], _offsets(i));
+
+                    const GA_Offset o = _offsets(idx);
+                    UT_Matrix4D& xform = _xforms[idx];
+
+                    /* Scale should come from scale attrs;
+                       only want orientation here.*/
+                    UT_Vector3F row = _i.get(o);
+                    row.normalize();
+                    xform[0] = UT_Vector4F(row);
+                    row = _j.get(o);
+                    row.normalize();
+                    xform[1] = UT_Vector4F(row);
+                    row = _k.get(o);
+                    row.normalize();
+                    xform[2] = UT_Vector4F(row);
+                    // XXX: P gets normalized along with the basis vectors.
+                    //      Kept as is so existing instancers don't move.
+                    row = _p.get(o);
+                    row.normalize();
+                    xform[3] = UT_Vector4F(row);
+
+                    if(hasPScale) {
+                        const float pscale = _pscale.get(o);
+                        for(int c = 0; c < 3; ++c)
+                            xform[c] *= pscale;
+                    }
+                    if(hasScale) {
+                        const UT_Vector3F scale = _scale.get(o);
+                        for(int c = 0; c < 3; ++c)
+                            xform[c] *= scale[c];
+                    }
                 }
             }
 private:
-    const ModifyFn&         _modifyFn;
+    const GA_ROHandleV3&    _i;
+    const GA_ROHandleV3&    _j;
+    const GA_ROHandleV3&    _k;
+    const GA_ROHandleV3&    _p;
+    const GA_ROHandleF&     _pscale;
+    const GA_ROHandleV3&    _scale;
     const GA_OffsetArray&   _offsets;
     UT_Matrix4D* const      _xforms;
 };
 
 
-struct _XformRowFromAttrFn
-{
-    _XformRowFromAttrFn(const GA_ROHandleV3& attr, int comp)
-        : _attr(attr), _comp(comp) {}
-
-    void    operator()(UT_Matrix4D& xform, GA_Offset o) const
-            {
-                UT_Vector3F vec = _attr.get(o);
-                /* Scale should come from scale attrs;
-                   only want orientation here.*/
-                vec.normalize();
-                xform[_comp] = UT_Vector4F(vec);
-            }
-
-private:
-    const GA_ROHandleV3&    _attr;
-    const int               _comp;
-};
-
-
-struct _XformApplyScaleFn
-{
-    _XformApplyScaleFn(const GA_ROHandleV3& attr) : _attr(attr) {}
-
-    void    operator()(UT_Matrix4D& xform, GA_Offset o) const
-            {
-                UT_Vector3F scale = _attr.get(o);
-                for(int i = 0; i < 3; ++i)
-                    xform[i] *= scale[i];
-            }
-private:
-    const GA_ROHandleV3&    _attr;
-};
-
-
-struct _XformApplyPScaleFn
-{
-    _XformApplyPScaleFn(const GA_ROHandleF& attr) : _attr(attr) {}
-
-    void    operator()(UT_Matrix4D& xform, GA_Offset o) const
-            {
-                float scale = _attr.get(o);
-                for(int i = 0; i < 3; ++i)
-                    xform[i] *= scale;
-            }
-private:
-    const GA_ROHandleF&    _attr;
-};
-
-
 struct _XformsFromInstMatrixFn
 {
     _XformsFromInstMatrixFn(const GA_AttributeInstanceMatrix& instMx,
@@ -1687,31 +1814,13 @@ GusdGU_USD::ComputeTransformsFromAttrs(const GA_Detail& gd,
 
     if(i.isValid() && j.isValid() && k.isValid()) {
 
-        GA_ROHandleV3 handles[] = {i, j, k, p};
-
-        for(int comp = 0; comp < 4; ++comp) {
-            UTparallelForLightItems(
-                rng, _ModifyXformsT<_XformRowFromAttrFn>(
-                    _XformRowFromAttrFn(handles[comp], comp), offsets, xforms));
-            if(task.wasInterrupted())
-                return false;
-        }
         GA_ROHandleF pscale(&gd, owner, GEO_STD_ATTRIB_PSCALE);
-        if(pscale.isValid()) {
-            UTparallelForLightItems(
-                rng, _ModifyXformsT<_XformApplyPScaleFn>(
-                    _XformApplyPScaleFn(pscale), offsets, xforms));
-            if(task.wasInterrupted())
-                return false;
-        }
         GA_ROHandleV3 scale(&gd, owner, "scale");
-        if(scale.isValid()) {
-            UTparallelForLightItems(
-                rng, _ModifyXformsT<_XformApplyScaleFn>(
-                    _XformApplyScaleFn(scale), offsets, xforms));
-            if(task.wasInterrupted())
-                return false;
-        }
+
+        UTparallelForLightItems(
+            rng, _XformsFromIJKFn(i, j, k, p, pscale, scale, offsets, xforms));
+        if(task.wasInterrupted())
+            return false;
         
         return true;
     }
@@ -248,6 +248,21 @@ public:
                             const UT_StringRef &nonTransformingPrimvarPattern,
                             GusdGU_PackedUSD::PivotLocation pivotloc);
 
+    /** Update packed prims previously created in @a gd by
+        AppendExpandedPackedPrimsFromLopNode() (when not unpacking to
+        polygons) for new @a times and new transforms of the source prims,
+        without rebuilding them. The stage ids, viewport LODs and purposes
+        of the source prims are reapplied as well. All prims in @a gd must be the ones created
+        for @a primIndexPairs; if they aren't, false is returned and @a gd
+        is left alone.*/
+    static bool         UpdateExpandedPackedPrimsFromLopNode(
+                            GU_Detail& gd,
+                            const GA_Detail& srcGd,
+                            const GA_Range& srcRng,
+                            const UT_Array<PrimIndexPair>& primIndexPairs,
+                            const GusdDefaultArray<UsdTimeCode>& times,
+                            GusdGU_PackedUSD::PivotLocation pivotloc);
+
     /** Apply all variant selections in @a selections to each prim
         in the range, storing the resulting variant path in @a variantsAttr.
         For each source prim, this will first validate that the
@@ -35,6 +35,7 @@
 #include <GT/GT_PrimNURBSCurveMesh.h>
 #include <GT/GT_Refine.h>
 #include <GT/GT_RefineParms.h>
+#include <UT/UT_ParallelUtil.h>
 
 #include <numeric>
 
@@ -244,11 +245,10 @@ GusdNURBSCurvesWrapper::refine(
                 // There was a time when the maya exported did not duplicate
                 // the end points when it should. 
                 auto knotArray = new GT_Real64Array( numKnots, 1 );
-                knotArray->set( usdKnots[0], 0 );
-                for( size_t i = 0; i < usdKnots.size(); ++i ) {
-                    knotArray->set( usdKnots[i], i+1 );
-                }
-                knotArray->set( usdKnots[usdKnots.size()-1], numKnots-1 );
+                fpreal64* knotData = knotArray->data();
+                knotData[0] = usdKnots[0];
+                std::copy( usdKnots.cbegin(), usdKnots.cend(), knotData + 1 );
+                knotData[numKnots-1] = usdKnots[usdKnots.size()-1];
                 gtKnots = knotArray;
             }
             else {
@@ -263,16 +263,33 @@ GusdNURBSCurvesWrapper::refine(
         // number of control points so just skip the first and last values.
         auto segEndPointIndicies = new GT_Int32Array( numPoints, 1 );
 
-        GT_Offset srcIdx = 0;
-        GT_Offset dstIdx = 0;
-        for( const auto& c : usdCounts ) {
-            ++srcIdx;
-            for( int i = 0; i < c; ++i ) {
-                segEndPointIndicies->set( srcIdx++, dstIdx++ );
-            }
-            ++srcIdx;
+        // Each curve's vertices start after the vertices of the previous
+        // curves, so the curves can be filled in parallel once the starting
+        // vertex of each has been found.
+        const size_t numCurves = usdCounts.size();
+        UT_Array<GT_Offset> curveStarts;
+        curveStarts.setSizeNoInit( numCurves );
+        GT_Offset start = 0;
+        for( size_t c = 0; c < numCurves; ++c ) {
+            curveStarts[c] = start;
+            start += usdCounts[c];
         }
-        UT_ASSERT(dstIdx == numPoints);
+        UT_ASSERT(start == numPoints);
+
+        int32* segEndPointData = segEndPointIndicies->data();
+        UTparallelForLightItems(UT_BlockedRange<size_t>(0, numCurves),
+            [&](const UT_BlockedRange<size_t>& r)
+            {
+                for( size_t c = r.begin(); c < r.end(); ++c ) {
+                    GT_Offset dstIdx = curveStarts[c];
+                    // Skip the first end point of this curve and both end
+                    // points of each preceding curve.
+                    GT_Offset srcIdx = dstIdx + 2*c + 1;
+                    for( int i = 0; i < usdCounts[c]; ++i ) {
+                        segEndPointData[dstIdx++] = srcIdx++;
+                    }
+                }
+            });
 
         UsdAttribute widthsAttr = usdCurves.GetWidthsAttr();
         VtFloatArray usdWidths;
@@ -640,32 +657,31 @@ GusdNURBSCurvesWrapper::updateFromGTPrim(
         updateAttributeFromGTPrim( GT_OWNER_INVALID, "vertexcounts",
                                    gtCurveCounts, usdAttr, topologyTime );
 
-        // Order
+        // Order. This is written like the vertex counts, so that it is
+        // only authored again when the topology changes.
         usdAttr = m_usdCurves.GetOrderAttr();
+        VtIntArray usdOrders;
         if( gtCurves->isUniformOrder() ) {
-            VtIntArray val( gtCurveCounts->entries() );
-            for( size_t i = 0; i < val.size(); ++i ) {
-                val[i] = gtCurves->uniformOrder();
-            }
-            usdAttr.Set( val );
+            usdOrders.assign( gtCurveCounts->entries(),
+                              gtCurves->uniformOrder() );
         }
         else {
-            GT_DataArrayHandle buffer;
-            const int64* gtOrders = gtCurves->varyingOrders()->getI64Array( buffer );
-            VtIntArray val( gtCurves->varyingOrders()->entries() );
-             for( size_t i = 0; i < val.size(); ++i ) {
-                val[i] = gtOrders[i];
-            }
-            usdAttr.Set( val );           
+            const GT_DataArrayHandle& varying = gtCurves->varyingOrders();
+            usdOrders.resize( varying->entries() );
+            varying->fillArray( usdOrders.data(), 0, usdOrders.size(), 1 );
         }
+        GT_DataArrayHandle gtOrders = new GusdGT_VtArray<int32>( usdOrders );
+
+        updateAttributeFromGTPrim( GT_OWNER_INVALID, "order",
+                                   gtOrders, usdAttr, topologyTime );
 
         // Knots 
-        GT_DataArrayHandle knotTmpBuffer;
         usdAttr = m_usdCurves.GetKnotsAttr();
         GT_DataArrayHandle gtKnots = gtCurves->knots();
         if( gtKnots->getStorage() != GT_STORE_REAL64 ) {
-            gtKnots = new GT_Real64Array( gtKnots->getF64Array( knotTmpBuffer ),
-                                          gtKnots->entries(), 1 );
+            VtDoubleArray usdKnots( gtKnots->entries() );
+            gtKnots->fillArray( usdKnots.data(), 0, usdKnots.size(), 1 );
+            gtKnots = new GusdGT_VtArray<fpreal64>( usdKnots );
         }
 
         updateAttributeFromGTPrim( GT_OWNER_INVALID, "knots",
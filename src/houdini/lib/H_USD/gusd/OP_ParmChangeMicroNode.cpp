@@ -41,9 +41,23 @@ struct GusdOP_ParmChangeMicroNode::_ParmCache
     virtual ~_ParmCache() {}
 
     virtual bool    Update(OP_Parameters& node, fpreal t, int thread) = 0;
+
+    /** Returns true if the parm must be evaluated again. A parm that is not
+        time dependent only needs to be re-evaluated if some parm changed,
+        not if only the evaluation time changed.*/
+    bool            NeedsUpdate(bool parmsChanged) const
+                    { return parmsChanged || !_evaluated || _timeDependent; }
+
+    void            MarkEvaluated(OP_Parameters& node)
+                    {
+                        _evaluated = true;
+                        _timeDependent = node.getParm(_pi).isTimeDependent();
+                    }
     
 protected:
     const int   _pi, _vi;
+    bool        _evaluated = false;
+    bool        _timeDependent = true;
 };
 
 
@@ -239,8 +253,18 @@ GusdOP_ParmChangeMicroNode::updateVals(fpreal t, int thread)
     int changed = _parmsAdded;
     _parmsAdded = false;
 
-    for(exint i = 0; i < _cachedVals.size(); ++i)
-        changed += GusdUTverify_ptr(_cachedVals(i))->Update(_node, t, thread);
+    // We are only dirty if one of our parm micro nodes was dirtied. If we
+    // are updating purely because the time changed, the parms that are not
+    // time dependent can't have changed.
+    const bool parmsChanged = isDirty();
+
+    for(exint i = 0; i < _cachedVals.size(); ++i) {
+        _ParmCache* cache = GusdUTverify_ptr(_cachedVals(i));
+        if(cache->NeedsUpdate(parmsChanged)) {
+            changed += cache->Update(_node, t, thread);
+            cache->MarkEvaluated(_node);
+        }
+    }
 
     DEP_TimedMicroNode::update(t);
     return changed;
@@ -25,6 +25,7 @@
 
 #include <OP/OP_Parameters.h>
 #include <PRM/PRM_Shared.h>
+#include <UT/UT_ConcurrentHashMap.h>
 
 #include "gusd/PRM_Shared.h"
 #include "gusd/USD_ThreadedTraverse.h"
@@ -245,6 +246,8 @@ GusdUSD_CustomTraverse::Opts::SetNamePattern(
     const char* pattern, bool caseSensitive)
 {
     _SetPattern(namePattern, pattern, caseSensitive);
+    namePatternSrc = pattern;
+    namePatternCase = caseSensitive;
 }
 
 
@@ -253,17 +256,121 @@ GusdUSD_CustomTraverse::Opts::SetPathPattern(
     const char* pattern, bool caseSensitive)
 {
     _SetPattern(pathPattern, pattern, caseSensitive);
+    pathPatternSrc = pattern;
+    pathPatternCase = caseSensitive;
+}
+
+
+size_t
+GusdUSD_CustomTraverse::Opts::GetHash() const
+{
+    size_t h = 0;
+    for(const TriState state : {active, visible, imageable, defined,
+                                abstract, model, group, instance,
+                                master, clips}) {
+        BOOST_NS::hash_combine(h, int(state));
+    }
+    BOOST_NS::hash_combine(h, traverseMatched);
+    for(const TfToken& purpose : purposes)
+        BOOST_NS::hash_combine(h, purpose);
+    for(const TfToken& kind : kinds)
+        BOOST_NS::hash_combine(h, kind);
+    for(const TfType& type : types)
+        BOOST_NS::hash_combine(h, type);
+    BOOST_NS::hash_combine(h, namePatternSrc.hash());
+    BOOST_NS::hash_combine(h, namePatternCase);
+    BOOST_NS::hash_combine(h, pathPatternSrc.hash());
+    BOOST_NS::hash_combine(h, pathPatternCase);
+    return h;
 }
 
 
 namespace {
 
 
+struct _TokenHashCmp
+{
+    static size_t   hash(const TfToken& token)
+                    { return token.Hash(); }
+    static bool     equal(const TfToken& a, const TfToken& b)
+                    { return a == b; }
+};
+
+using _TokenMatchMap = UT_ConcurrentHashMap<TfToken,bool,_TokenHashCmp>;
+
+
+/** Results of the type and kind tests, shared by all of the traversal
+    tasks of a single FindPrims() call. Scenes only have a handful of
+    distinct prim types and kinds, so each one is only tested against the
+    TfType and kind hierarchies once, rather than once per prim.*/
+struct _MatchCache
+{
+    _MatchCache(const GusdUSD_CustomTraverse::Opts& opts) : _opts(opts) {}
+
+    bool    MatchesType(const TfToken& typeName);
+    bool    MatchesKind(const TfToken& kind);
+
+private:
+    const GusdUSD_CustomTraverse::Opts& _opts;
+    _TokenMatchMap                      _types, _kinds;
+};
+
+
+bool
+_MatchCache::MatchesType(const TfToken& typeName)
+{
+    {
+        _TokenMatchMap::const_accessor a;
+        if(_types.find(a, typeName))
+            return a->second;
+    }
+
+    bool match = false;
+    if(!typeName.IsEmpty()) {
+        const TfType type =
+            PlugRegistry::FindDerivedTypeByName<UsdSchemaBase>(
+                typeName.GetString());
+        for(const TfType& t : _opts.types) {
+            if(type.IsA(t)) {
+                match = true;
+                break;
+            }
+        }
+    }
+    _types.insert(std::make_pair(typeName, match));
+    return match;
+}
+
+
+bool
+_MatchCache::MatchesKind(const TfToken& kind)
+{
+    {
+        _TokenMatchMap::const_accessor a;
+        if(_kinds.find(a, kind))
+            return a->second;
+    }
+
+    bool match = false;
+    for(const TfToken& k : _opts.kinds) {
+        if(KindRegistry::IsA(kind, k)) {
+            match = true;
+            break;
+        }
+    }
+    _kinds.insert(std::make_pair(kind, match));
+    return match;
+}
+
+
 struct _Visitor
 {
-    _Visitor(const GusdUSD_CustomTraverse::Opts& opts)
+    _Visitor(const GusdUSD_CustomTraverse::Opts& opts, _MatchCache& matches)
         : _opts(opts),
-          _predicate(opts.MakePredicate()) {}
+          _matches(matches),
+          _predicate(opts.MakePredicate()),
+          _allPurposes(opts.purposes.size() ==
+                       UsdGeomImageable::GetOrderedPurposeTokens().size()) {}
 
     Usd_PrimFlagsPredicate  TraversalPredicate() const
                             {
@@ -293,7 +400,9 @@ struct _Visitor
 
 private:
     const GusdUSD_CustomTraverse::Opts& _opts;
+    _MatchCache&                        _matches;
     const Usd_PrimFlagsPredicate        _predicate;
+    const bool                          _allPurposes;
     TfToken _vis, _purpose;
 };
 
@@ -348,20 +457,7 @@ _Visitor::AcceptType(const UsdPrim& prim) const
     if(_opts.types.size() == 0)
         return true;
 
-    const std::string& typeName = prim.GetTypeName().GetString();
-    if(!typeName.empty()) {
-        /* TODO: profile this search.
-                 It may be faster to fill an unordered set of type
-                 names to do this test instead.*/
-        TfType type =
-            PlugRegistry::FindDerivedTypeByName<UsdSchemaBase>(typeName);
-        for(auto& t : _opts.types) {
-            if(type.IsA(t)) {
-                return true;
-            }
-        }
-    }
-    return false;
+    return _matches.MatchesType(prim.GetTypeName());
 }
 
 
@@ -369,7 +465,7 @@ bool
 _Visitor::AcceptPurpose(const UsdGeomImageable& prim,
                         GusdUSD_TraverseControl& ctl)
 {
-    if(_opts.purposes.size() == 0)
+    if(_opts.purposes.size() == 0 || _allPurposes)
         return true;
 
     if (!_purpose.IsEmpty()) {
@@ -408,11 +504,7 @@ _Visitor::AcceptKind(const UsdPrim& prim) const
     UsdModelAPI model(prim);
     TfToken kind;
     model.GetKind(&kind);
-    for(auto& k : _opts.kinds) {
-        if(KindRegistry::IsA(kind, k))
-            return true;
-    }
-    return false;
+    return _matches.MatchesKind(kind);
 }
 
 
@@ -481,7 +573,9 @@ GusdUSD_CustomTraverse::FindPrims(const UsdPrim& root,
                                   const GusdUSD_Traverse::Opts* opts) const
 {
     const auto* customOpts = UTverify_cast<const Opts*>(opts);
-    _Visitor visitor(customOpts ? *customOpts : _defaultOpts);
+    const Opts& o = customOpts ? *customOpts : _defaultOpts;
+    _MatchCache matches(o);
+    _Visitor visitor(o, matches);
 
     return GusdUSD_ThreadedTraverse::ParallelFindPrims(
         root, time, purposes, prims, visitor, skipRoot);
@@ -498,13 +592,31 @@ GusdUSD_CustomTraverse::FindPrims(
     const GusdUSD_Traverse::Opts* opts) const
 {
     const auto* customOpts = UTverify_cast<const Opts*>(opts);
-    _Visitor visitor(customOpts ? *customOpts : _defaultOpts);
+    const Opts& o = customOpts ? *customOpts : _defaultOpts;
+    _MatchCache matches(o);
+    _Visitor visitor(o, matches);
 
     return GusdUSD_ThreadedTraverse::ParallelFindPrims(
         roots, times, purposes, prims, visitor, skipRoot);
 }
 
 
+bool
+GusdUSD_CustomTraverse::GetCacheHash(const GusdUSD_Traverse::Opts* opts,
+                                     size_t& hash) const
+{
+    const auto* customOpts = UTverify_cast<const Opts*>(opts);
+    const Opts& o = customOpts ? *customOpts : _defaultOpts;
+
+    // Visibility is the only option that is evaluated over time.
+    if(o.visible != ANY_STATE)
+        return false;
+
+    hash = o.GetHash();
+    return true;
+}
+
+
 namespace {
 
 
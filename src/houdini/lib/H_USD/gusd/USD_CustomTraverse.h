@@ -28,6 +28,7 @@
 
 #include "USD_Traverse.h"
 
+#include <UT/UT_StringHolder.h>
 #include <UT/UT_StringMMPattern.h>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -81,16 +82,27 @@ public:
         Usd_PrimFlagsPredicate  MakePredicate() const;
 
         
+        /** Compute a hash of all options.*/
+        size_t              GetHash() const;
+
         TriState            active, visible, imageable, defined, abstract,
                             model, group, instance, master, clips;
         bool                traverseMatched;
         UT_Array<TfToken>   purposes, kinds;
         UT_Array<TfType>    types;
         UT_StringMMPattern  namePattern, pathPattern;
+
+        /** Source strings of the name and path patterns, with
+            their case sensitivity. Used only for hashing. */
+        UT_StringHolder     namePatternSrc, pathPatternSrc;
+        bool                namePatternCase = true, pathPatternCase = true;
     };
 
     Opts*           CreateOpts() const override  { return new Opts; }
 
+    bool            GetCacheHash(const GusdUSD_Traverse::Opts* opts,
+                                 size_t& hash) const override;
+
     bool            FindPrims(const UsdPrim& root,
                               UsdTimeCode time,
                               GusdPurposeSet purposes,
@@ -25,14 +25,78 @@
 #include "gusd/USD_PropertyMap.h"
 #include "gusd/UT_Gf.h"
 
+#include "gusd/debugCodes.h"
+
+#include "pxr/base/tf/notice.h"
+#include "pxr/base/tf/weakBase.h"
+#include "pxr/usd/usd/notice.h"
 #include "pxr/usd/usdGeom/xformable.h"
 
 #include <UT/UT_Matrix4.h>
 
+#include <algorithm>
+
 
 PXR_NAMESPACE_OPEN_SCOPE
 
 
+/// Forwards object changes on any stage to a data cache.
+class GusdUSD_DataCache::_StageChangeListener : public TfWeakBase
+{
+public:
+    _StageChangeListener(GusdUSD_DataCache& cache)
+        : _cache(cache)
+    {
+        _noticeKey = TfNotice::Register(
+            TfCreateWeakPtr(this),
+            &_StageChangeListener::_HandleObjectsChanged);
+    }
+
+    ~_StageChangeListener()
+    {
+        TfNotice::Revoke(_noticeKey);
+    }
+
+private:
+    void    _HandleObjectsChanged(const UsdNotice::ObjectsChanged& n,
+                                  const UsdStageWeakPtr& sender);
+
+    GusdUSD_DataCache&  _cache;
+    TfNotice::Key       _noticeKey;
+};
+
+
+void
+GusdUSD_DataCache::_StageChangeListener::_HandleObjectsChanged(
+    const UsdNotice::ObjectsChanged& n,
+    const UsdStageWeakPtr& sender)
+{
+    if(!sender)
+        return;
+
+    // Both resyncs and info-only changes may affect cached values of the
+    // changed prims, and of everything beneath them (such as inherited
+    // transforms or visibility). Changed properties map to their prims.
+    SdfPathVector subtrees;
+    for(const SdfPath& path : n.GetResyncedPaths())
+        subtrees.push_back(path.GetPrimPath());
+    for(const SdfPath& path : n.GetChangedInfoOnlyPaths())
+        subtrees.push_back(path.GetPrimPath());
+    if(subtrees.empty())
+        return;
+
+    // Sorts the paths, and strips out any that lie beneath another.
+    SdfPath::RemoveDescendentPaths(&subtrees);
+
+    const int64 freed = _cache.ClearSubtrees(sender, subtrees);
+
+    TF_DEBUG(GUSD_STAGECACHE).Msg(
+        "[GusdUSD_DataCache] Cleared %lld bytes for %zd changed subtrees of "
+        "%s\n", (long long)freed, subtrees.size(),
+        UsdDescribe(sender).c_str());
+}
+
+
 GusdUSD_DataCache::GusdUSD_DataCache(GusdStageCache& cache)
     : _stageCache(cache)
 {
@@ -47,9 +111,18 @@ GusdUSD_DataCache::GusdUSD_DataCache()
 
 GusdUSD_DataCache::~GusdUSD_DataCache()
 {
+    _changeListener.reset();
     _stageCache.RemoveDataCache(*this);
 }
 
+
+void
+GusdUSD_DataCache::_TrackStageChanges()
+{
+    if(!_changeListener)
+        _changeListener.reset(new _StageChangeListener(*this));
+}
+
 bool
 GusdUSD_DataCache::ShouldClearPrim(
     const UsdPrim& prim,
@@ -74,4 +147,26 @@ GusdUSD_DataCache::ShouldClearPrim(
 }
 
 
+bool
+GusdUSD_DataCache::ShouldClearPrim(
+    const UsdPrim& prim,
+    const UsdStagePtr& stage,
+    const SdfPathVector& subtrees)
+{
+    if(!prim) {
+        // Always clear expired prims.
+        return true;
+    }
+    if(prim.GetStage() != stage)
+        return false;
+
+    // Find the last subtree root that sorts at or before the prim.
+    // Since the subtrees don't overlap, that's the only one that can
+    // contain the prim.
+    const SdfPath& path = prim.GetPath();
+    auto it = std::upper_bound(subtrees.begin(), subtrees.end(), path);
+    return it != subtrees.begin() && path.HasPrefix(*(--it));
+}
+
+
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -29,8 +29,10 @@
 
 #include "pxr/pxr.h"
 #include "pxr/base/tf/token.h"
+#include "pxr/usd/sdf/path.h"
 
 #include <UT/UT_StringSet.h>
+#include <UT/UT_UniquePtr.h>
 
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -55,6 +57,21 @@ public:
     /// Clear caches for a set of stages by path    
     virtual int64   Clear(const UT_StringSet& stagePaths) { return 0; }
 
+    /// Clear cache entries for prims of @a stage that are at or beneath
+    /// any of the @a subtrees. The subtree paths are sorted, and none of
+    /// them is a descendant of another.
+    /// This is only invoked for caches that track stage changes
+    /// (see _TrackStageChanges()).
+    virtual int64   ClearSubtrees(const UsdStagePtr& stage,
+                                  const SdfPathVector& subtrees)
+                    { return 0; }
+
+    /// Name of the cache, as shown in memory reports.
+    virtual const char* GetName() const { return GUSDUT_USDCACHE_NAME; }
+
+    /// Returns the memory held by the cache, in bytes.
+    virtual int64   GetMemoryUsage() const { return 0; }
+
 
     /// Helper for implementations to decide if a cache entry
     /// corresponding to @a prim should be discarded.
@@ -62,8 +79,26 @@ public:
                         const UsdPrim& prim,
                         const UT_StringSet& stagesToClear);
 
+    /// Helper for implementations of ClearSubtrees() to decide if a cache
+    /// entry corresponding to @a prim should be discarded.
+    static bool     ShouldClearPrim(
+                        const UsdPrim& prim,
+                        const UsdStagePtr& stage,
+                        const SdfPathVector& subtrees);
+
 protected:
+    /// Listen for UsdNotice::ObjectsChanged notices from all stages,
+    /// passing all prim subtrees affected by changes to ClearSubtrees().
+    /// This allows entries to be invalidated incrementally, rather than
+    /// requiring the full cache to be cleared.
+    void            _TrackStageChanges();
+
     GusdStageCache& _stageCache;
+
+private:
+    class _StageChangeListener;
+
+    UT_UniquePtr<_StageChangeListener>  _changeListener;
 };
 
 
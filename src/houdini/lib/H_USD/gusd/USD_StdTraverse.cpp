@@ -228,11 +228,13 @@ typedef DefaultImageablePrimVisitorT<
 } /*namespace*/
 
 
+// None of the standard visitors depend on time.
 #define _DECLARE_STATIC_TRAVERSAL(name,visitor)         \
     const GusdUSD_Traverse& name()                      \
     {                                                   \
         static visitor v;                               \
-        static GusdUSD_TraverseSimpleT<visitor> t(v);   \
+        static GusdUSD_TraverseSimpleT<visitor> t(      \
+            v, /*time dependent*/ false);               \
         return t;                                       \
     }
     
@@ -37,6 +37,7 @@
 
 #include "pxr/pxr.h"
 #include "pxr/base/arch/hints.h"
+#include "pxr/base/trace/trace.h"
 #include "pxr/usd/usd/prim.h"
 #include "pxr/usd/usdGeom/imageable.h"
 
@@ -89,9 +90,16 @@ DefaultImageablePrimVisitorT<Visitor,Recursive>::AcceptPrim(
 {
     UsdGeomImageable ip(prim);
     if(ip) {
-        TfToken purpose;
-        ip.GetPurposeAttr().Get(&purpose);
-        if( GusdPurposeInSet( purpose, purposes )) {
+        /* Purpose is uniform, so it never varies with time. If all
+           purposes are accepted there is no need to resolve it at all,
+           which saves an attribute read on every imageable prim.*/
+        bool inSet = GusdPurposeSetIsAll(purposes);
+        if(!inSet) {
+            TfToken purpose;
+            ip.GetPurposeAttr().Get(&purpose);
+            inSet = GusdPurposeInSet( purpose, purposes );
+        }
+        if( inSet ) {
             if(ARCH_UNLIKELY(Visitor()(prim, time, ctl))) {
                 if(!Recursive)
                     ctl.PruneChildren();
@@ -226,6 +234,8 @@ ParallelFindPrims(const UsdPrim& root,
                   const Visitor& visitor,
                   bool skipRoot)
 {
+    TRACE_FUNCTION();
+
     TaskData data;
     bool skipPrim = skipRoot || root.GetPath() == SdfPath::AbsoluteRootPath();
     auto& task =
@@ -295,6 +305,8 @@ ParallelFindPrims(const UT_Array<UsdPrim>& roots,
                   const Visitor& visitor,
                   bool skipRoot)
 {
+    TRACE_FUNCTION();
+
     TaskData data;
     UTparallelFor(UT_BlockedRange<std::size_t>(0, roots.size()),
                   RunTasksT<Visitor>(roots, times, purposes,
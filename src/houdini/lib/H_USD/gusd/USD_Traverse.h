@@ -91,6 +91,13 @@ public:
                               bool skipRoot=true,
                               const Opts* opts=nullptr) const;
 
+    /** Compute a hash of the traversal configuration in @a opts, for use
+        in caching traversal results (see GusdUSD_TraverseCache).
+        Returns false if the results can't be cached, such as when they
+        depend on the traversal time.*/
+    virtual bool    GetCacheHash(const Opts* opts, size_t& hash) const
+                    { return false; }
+
     /** Base class that can be derived to provide
         configuration options to the traversal.*/
     struct Opts
@@ -0,0 +1,189 @@
+//
+// Copyright 2017 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#include "gusd/USD_TraverseCache.h"
+
+#include "pxr/base/tf/hash.h"
+
+#include <algorithm>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+
+GusdUSD_TraverseCache::_Key::_Key(
+    const GusdUSD_Traverse* traverse,
+    size_t optsHash,
+    bool skipRoot,
+    const UT_Array<UsdPrim>& roots,
+    const GusdDefaultArray<GusdPurposeSet>& purposes)
+    : traverse(traverse), optsHash(optsHash), skipRoot(skipRoot),
+      roots(roots), purposes(purposes)
+{
+    hash = TfHash()(traverse);
+    BOOST_NS::hash_combine(hash, optsHash);
+    BOOST_NS::hash_combine(hash, skipRoot);
+    for(const UsdPrim& root : roots)
+        BOOST_NS::hash_combine(hash, root);
+    BOOST_NS::hash_combine(hash, int(purposes.GetDefault()));
+    for(const GusdPurposeSet purpose : purposes.GetArray())
+        BOOST_NS::hash_combine(hash, int(purpose));
+}
+
+
+bool
+GusdUSD_TraverseCache::_Key::operator==(const _Key& o) const
+{
+    return hash == o.hash &&
+           traverse == o.traverse &&
+           optsHash == o.optsHash &&
+           skipRoot == o.skipRoot &&
+           purposes.GetDefault() == o.purposes.GetDefault() &&
+           purposes.GetArray() == o.purposes.GetArray() &&
+           roots == o.roots;
+}
+
+
+GusdUSD_TraverseCache::GusdUSD_TraverseCache(GusdStageCache& cache)
+  : GusdUSD_DataCache(cache),
+    _entries(GUSDUT_USDCACHE_NAME, 64)
+{
+    _TrackStageChanges();
+}
+
+
+GusdUSD_TraverseCache::GusdUSD_TraverseCache()
+  : GusdUSD_TraverseCache(GusdStageCache::GetInstance())
+{}
+
+
+GusdUSD_TraverseCache&
+GusdUSD_TraverseCache::GetInstance()
+{
+    static GusdUSD_TraverseCache cache;
+    return cache;
+}
+
+
+bool
+GusdUSD_TraverseCache::FindPrims(
+    const GusdUSD_Traverse& traverse,
+    const UT_Array<UsdPrim>& roots,
+    const GusdDefaultArray<UsdTimeCode>& times,
+    const GusdDefaultArray<GusdPurposeSet>& purposes,
+    UT_Array<PrimIndexPair>& prims,
+    bool skipRoot,
+    const GusdUSD_Traverse::Opts* opts)
+{
+    size_t optsHash = 0;
+    if(!traverse.GetCacheHash(opts, optsHash)) {
+        return traverse.FindPrims(roots, times, purposes,
+                                  prims, skipRoot, opts);
+    }
+
+    const _CappedKey key(_Key(&traverse, optsHash, skipRoot,
+                              roots, purposes));
+
+    if(auto entry = _entries.Find<_Entry>(key)) {
+        prims = entry->prims;
+        return true;
+    }
+
+    UT_IntrusivePtr<_Entry> entry(new _Entry);
+    if(!traverse.FindPrims(roots, times, purposes,
+                           entry->prims, skipRoot, opts)) {
+        return false;
+    }
+    prims = entry->prims;
+    _entries.addItem(key, UT_CappedItemHandle(entry.get()));
+    return true;
+}
+
+
+void
+GusdUSD_TraverseCache::Clear()
+{
+    _entries.clear();
+}
+
+
+int64
+GusdUSD_TraverseCache::Clear(const UT_StringSet& paths)
+{
+    return _entries.ClearEntries(
+        [&](const UT_CappedKeyHandle& key,
+            const UT_CappedItemHandle& item) {
+
+        const auto& k = *UTverify_cast<const _CappedKey*>(key.get());
+        for(const UsdPrim& root : k->roots) {
+            if(ShouldClearPrim(root, paths))
+                return true;
+        }
+        return false;
+    });
+}
+
+
+namespace {
+
+/// Returns true if @a root is at, beneath or above any of the @a subtrees.
+/// I.e., if the results of a traversal beneath @a root could
+/// be affected by a change of the subtrees.
+bool
+_RootOverlapsSubtrees(const SdfPath& root, const SdfPathVector& subtrees)
+{
+    // The subtrees are sorted, with no subtree a descendant of another.
+    // So the only subtree that can hold the root is the last one
+    // preceding it, and any subtrees beneath the root follow it.
+    auto it = std::upper_bound(subtrees.begin(), subtrees.end(), root);
+    if(it != subtrees.begin() && root.HasPrefix(*(it-1)))
+        return true;
+    return it != subtrees.end() && it->HasPrefix(root);
+}
+
+} /*namespace*/
+
+
+int64
+GusdUSD_TraverseCache::ClearSubtrees(const UsdStagePtr& stage,
+                                     const SdfPathVector& subtrees)
+{
+    return _entries.ClearEntries(
+        [&](const UT_CappedKeyHandle& key,
+            const UT_CappedItemHandle& item) {
+
+        const auto& k = *UTverify_cast<const _CappedKey*>(key.get());
+        for(const UsdPrim& root : k->roots) {
+            if(!root) {
+                continue;
+            }
+            if(root.GetStage() == stage &&
+               _RootOverlapsSubtrees(root.GetPath(), subtrees)) {
+                return true;
+            }
+        }
+        return false;
+    });
+}
+
+
+PXR_NAMESPACE_CLOSE_SCOPE
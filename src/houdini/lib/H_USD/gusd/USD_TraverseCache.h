@@ -0,0 +1,132 @@
+//
+// Copyright 2017 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#ifndef _GUSD_USD_TRAVERSECACHE_H_
+#define _GUSD_USD_TRAVERSECACHE_H_
+
+#include "gusd/api.h"
+
+#include "gusd/defaultArray.h"
+#include "gusd/purpose.h"
+#include "gusd/USD_DataCache.h"
+#include "gusd/USD_Traverse.h"
+#include "gusd/UT_CappedCache.h"
+
+#include "pxr/pxr.h"
+#include "pxr/usd/usd/prim.h"
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/** Thread-safe, memory-capped cache of traversal results.
+    Results are keyed by the traversal, its configuration, the root prims
+    and the purposes. Only traversals whose results don't depend on time
+    are cached (see GusdUSD_Traverse::GetCacheHash()), so the same results
+    can be reused when only the frame changes.
+    Entries are invalidated when any prim in or above the traversed
+    subtrees changes on its stage.*/
+class GusdUSD_TraverseCache final : public GusdUSD_DataCache
+{
+public:
+    typedef GusdUSD_Traverse::PrimIndexPair PrimIndexPair;
+
+    GUSD_API
+    static GusdUSD_TraverseCache&   GetInstance();
+
+    GusdUSD_TraverseCache(GusdStageCache& cache);
+    GusdUSD_TraverseCache();
+
+    ~GusdUSD_TraverseCache() override {}
+
+    /** Equivalent to GusdUSD_Traverse::FindPrims(), but reusing previous
+        results of the same traversal when possible.
+        Traversals that can't be cached are always run.*/
+    GUSD_API
+    bool    FindPrims(const GusdUSD_Traverse& traverse,
+                      const UT_Array<UsdPrim>& roots,
+                      const GusdDefaultArray<UsdTimeCode>& times,
+                      const GusdDefaultArray<GusdPurposeSet>& purposes,
+                      UT_Array<PrimIndexPair>& prims,
+                      bool skipRoot=true,
+                      const GusdUSD_Traverse::Opts* opts=nullptr);
+
+    GUSD_API
+    void    Clear() override;
+
+    GUSD_API
+    int64   Clear(const UT_StringSet& paths) override;
+
+    GUSD_API
+    int64   ClearSubtrees(const UsdStagePtr& stage,
+                          const SdfPathVector& subtrees) override;
+
+    const char* GetName() const override { return "Traversal Cache"; }
+
+    int64   GetMemoryUsage() const override
+            { return _entries.getMemoryUsage(); }
+
+private:
+    struct _Key
+    {
+        _Key(const GusdUSD_Traverse* traverse,
+             size_t optsHash,
+             bool skipRoot,
+             const UT_Array<UsdPrim>& roots,
+             const GusdDefaultArray<GusdPurposeSet>& purposes);
+
+        bool                operator==(const _Key& o) const;
+
+        struct HashCmp
+        {
+            static size_t   hash(const _Key& key)
+                            { return key.hash; }
+            static bool     equal(const _Key& a, const _Key& b)
+                            { return a == b; }
+        };
+
+        const GusdUSD_Traverse*             traverse;
+        size_t                              optsHash;
+        bool                                skipRoot;
+        UT_Array<UsdPrim>                   roots;
+        GusdDefaultArray<GusdPurposeSet>    purposes;
+        size_t                              hash;
+    };
+
+    typedef GusdUT_CappedKey<_Key,_Key::HashCmp>    _CappedKey;
+
+    struct _Entry : public UT_CappedItem
+    {
+        _Entry() : UT_CappedItem() {}
+        ~_Entry() override {}
+
+        int64   getMemoryUsage() const override
+                { return sizeof(*this) + prims.getMemoryUsage(false); }
+
+        UT_Array<PrimIndexPair> prims;
+    };
+
+    GusdUT_CappedCache  _entries;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif /*_GUSD_USD_TRAVERSECACHE_H_*/
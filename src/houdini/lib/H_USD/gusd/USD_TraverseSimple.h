@@ -40,8 +40,11 @@ template <class Visitor>
 class GusdUSD_TraverseSimpleT : public GusdUSD_Traverse
 {
 public:
-    GusdUSD_TraverseSimpleT(const Visitor& visitor)
-        : GusdUSD_Traverse(), _visitor(visitor) {}
+    /** If @a timeDependent is false, the results of @a visitor are
+        assumed to not depend on time, allowing them to be cached.*/
+    GusdUSD_TraverseSimpleT(const Visitor& visitor, bool timeDependent=true)
+        : GusdUSD_Traverse(), _visitor(visitor),
+          _timeDependent(timeDependent) {}
 
     ~GusdUSD_TraverseSimpleT() override {}
 
@@ -59,8 +62,15 @@ public:
                       bool skipRoot=true,
                       const Opts* opts=NULL) const override;
 
+    bool    GetCacheHash(const Opts* opts, size_t& hash) const override
+            {
+                hash = 0;
+                return !_timeDependent;
+            }
+
 private:
     const Visitor&  _visitor;
+    const bool      _timeDependent;
 };
 
 
@@ -33,7 +33,9 @@ PXR_NAMESPACE_OPEN_SCOPE
 GusdUSD_VisCache::GusdUSD_VisCache(GusdStageCache& cache)
   : GusdUSD_DataCache(cache),
     _visInfos(GUSDUT_USDCACHE_NAME, 256)
-{}
+{
+    _TrackStageChanges();
+}
 
 
 GusdUSD_VisCache::GusdUSD_VisCache()
@@ -244,7 +246,8 @@ namespace {
 
 template <typename KeyT>
 int64
-_RemoveKeysT(const UT_StringSet& paths, GusdUT_CappedCache& cache)
+_RemoveKeysT(const UT_StringSet& paths,
+             GusdUT_ShardedCappedCache& cache)
 {
     return cache.ClearEntries(
         [&](const UT_CappedKeyHandle& key,
@@ -257,6 +260,23 @@ _RemoveKeysT(const UT_StringSet& paths, GusdUT_CappedCache& cache)
 }
 
 
+template <typename KeyT>
+int64
+_RemoveSubtreeKeysT(const UsdStagePtr& stage,
+                    const SdfPathVector& subtrees,
+                    GusdUT_ShardedCappedCache& cache)
+{
+    return cache.ClearEntries(
+        [&](const UT_CappedKeyHandle& key,
+            const UT_CappedItemHandle& item) {
+
+        return GusdUSD_DataCache::ShouldClearPrim(
+            (*UTverify_cast<const KeyT*>(key.get()))->prim,
+            stage, subtrees);
+    });
+}
+
+
 } /*namespace*/
 
 
@@ -266,4 +286,12 @@ GusdUSD_VisCache::Clear(const UT_StringSet& paths)
     return _RemoveKeysT<_UnvaryingKey>(paths, _visInfos);
 }
 
+
+int64
+GusdUSD_VisCache::ClearSubtrees(const UsdStagePtr& stage,
+                                const SdfPathVector& subtrees)
+{
+    return _RemoveSubtreeKeysT<_UnvaryingKey>(stage, subtrees, _visInfos);
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -67,6 +67,15 @@ public:
     GUSD_API
     int64   Clear(const UT_StringSet& paths) override;
 
+    GUSD_API
+    int64   ClearSubtrees(const UsdStagePtr& stage,
+                          const SdfPathVector& subtrees) override;
+
+    const char* GetName() const override { return "Visibility Cache"; }
+
+    int64   GetMemoryUsage() const override
+            { return _visInfos.GetMemoryUsage(); }
+
 private:
     struct VisInfo : public UT_CappedItem
     {
@@ -90,7 +99,7 @@ private:
                                    UsdTimeCode time,
                                    bool& vis);
 
-    GusdUT_CappedCache  _visInfos;
+    GusdUT_ShardedCappedCache   _visInfos;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
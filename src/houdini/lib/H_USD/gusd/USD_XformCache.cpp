@@ -28,13 +28,31 @@
 #include "gusd/UT_CappedCache.h"
 
 #include "pxr/base/arch/hints.h"
+#include "pxr/base/tf/envSetting.h"
+#include "pxr/base/trace/trace.h"
 
+#include <SYS/SYS_Math.h>
 #include <UT/UT_Interrupt.h>
+#include <UT/UT_Map.h>
+#include <UT/UT_Matrix3.h>
 #include <UT/UT_Matrix4.h>
 #include <UT/UT_ParallelUtil.h>
+#include <UT/UT_Quaternion.h>
+#include <UT/UT_Vector3.h>
+
+#include <algorithm>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+
+TF_DEFINE_ENV_SETTING(GUSD_XFORMCACHE_INTERPOLATE, false,
+                      "Compute local transforms of time-varying prims by "
+                      "interpolating between the authored time samples, "
+                      "which are evaluated only once per prim. This greatly "
+                      "reduces the number of cache entries when sampling "
+                      "many sub-frame times, such as for motion blur.");
+
+
 namespace {
 
 typedef GusdUT_CappedKey<GusdUSD_UnvaryingPropertyKey,
@@ -57,6 +75,142 @@ struct _CappedXformItem : public UT_CappedItem
 
 typedef UT_IntrusivePtr<const _CappedXformItem> _CappedXformItemHandle;
 
+
+/** Authored local transform samples of a prim.
+    Samples are stored as separate arrays of decomposed components, so that
+    transforms at arbitrary times can be interpolated without going back
+    to USD. An empty item marks prims that can't be interpolated.*/
+struct _XformSamplesItem : public UT_CappedItem
+{
+    /** Don't bother interpolating prims with excessive numbers of samples;
+        evaluating every sample up front would cost more than it saves.*/
+    static const exint  MAX_SAMPLES = 4096;
+
+    _XformSamplesItem() : UT_CappedItem() {}
+
+    ~_XformSamplesItem() override {}
+
+    int64   getMemoryUsage() const override
+            {
+                return sizeof(*this) +
+                       times.getMemoryUsage(false) +
+                       translates.getMemoryUsage(false) +
+                       orients.getMemoryUsage(false) +
+                       stretches.getMemoryUsage(false);
+            }
+
+    bool    IsValid() const { return times.size() > 0; }
+
+    /** Evaluate and decompose all samples of @a query.*/
+    void    Init(const UsdGeomXformable::XformQuery& query, bool held);
+
+    /** Interpolate the transform at @a time.*/
+    void    Eval(double time, UT_Matrix4D& xform) const;
+
+    UT_Array<double>            times;
+    UT_Array<UT_Vector3D>       translates;
+    UT_Array<UT_QuaternionD>    orients;
+    UT_Array<UT_Matrix3D>       stretches;
+    bool                        held = false;
+};
+
+typedef UT_IntrusivePtr<const _XformSamplesItem> _XformSamplesItemHandle;
+
+
+void
+_XformSamplesItem::Init(const UsdGeomXformable::XformQuery& query, bool held)
+{
+    std::vector<double> sampleTimes;
+    if(!query.GetTimeSamples(&sampleTimes) ||
+       sampleTimes.size() < 2 ||
+       exint(sampleTimes.size()) > MAX_SAMPLES) {
+        return;
+    }
+
+    const exint n = sampleTimes.size();
+    translates.setSizeNoInit(n);
+    orients.setSizeNoInit(n);
+    stretches.setSizeNoInit(n);
+
+    for(exint i = 0; i < n; ++i) {
+        UT_Matrix4D xf;
+        if(!query.GetLocalTransformation(GusdUT_Gf::Cast(&xf),
+                                         UsdTimeCode(sampleTimes[i]))) {
+            xf.identity();
+        }
+
+        // Polar decomposition into M = S*R, plus translation.
+        UT_Matrix3D m3(xf);
+        if(m3.determinant() <= 0) {
+            // Mirroring or degenerate transforms can't be decomposed into
+            // a rotation; leave these up to USD.
+            translates.clear();
+            orients.clear();
+            stretches.clear();
+            return;
+        }
+        UT_Matrix3D rot(m3);
+        rot.makeRotationMatrix();
+
+        UT_Matrix3D rotT(rot);
+        rotT.transpose();
+
+        orients[i].updateFromRotationMatrix(rot);
+        stretches[i] = m3 * rotT;
+        xf.getTranslates(translates[i]);
+
+        // Keep consecutive quaternions in the same hemisphere, so that
+        // interpolation takes the shortest path.
+        if(i > 0) {
+            const UT_QuaternionD& q = orients[i];
+            const UT_QuaternionD& p = orients[i-1];
+            if(q.x()*p.x() + q.y()*p.y() + q.z()*p.z() + q.w()*p.w() < 0)
+                orients[i] = UT_QuaternionD(-q.x(), -q.y(), -q.z(), -q.w());
+        }
+    }
+    times.setSizeNoInit(n);
+    std::copy(sampleTimes.begin(), sampleTimes.end(), times.begin());
+    this->held = held;
+}
+
+
+void
+_XformSamplesItem::Eval(double time, UT_Matrix4D& xform) const
+{
+    UT_ASSERT_P(IsValid());
+
+    // Values are held outside of the sampled range.
+    exint i0, i1;
+    double u = 0;
+    if(time <= times.first()) {
+        i0 = i1 = 0;
+    } else if(time >= times.last()) {
+        i0 = i1 = times.size()-1;
+    } else {
+        i1 = std::upper_bound(times.begin(), times.end(), time) -
+             times.begin();
+        i0 = i1-1;
+        u = held ? 0.0 : (time - times(i0)) / (times(i1) - times(i0));
+    }
+
+    UT_Matrix3D rot;
+    UT_Matrix3D stretch;
+    UT_Vector3D t;
+    if(u <= 0) {
+        orients(i0).getRotationMatrix(rot);
+        stretch = stretches(i0);
+        t = translates(i0);
+    } else {
+        UT_QuaternionD q(orients(i0));
+        q.interpolate(orients(i1), u);
+        q.getRotationMatrix(rot);
+        stretch = stretches(i0)*(1.0-u) + stretches(i1)*u;
+        t = translates(i0)*(1.0-u) + translates(i1)*u;
+    }
+    xform = UT_Matrix4D(stretch * rot);
+    xform.setTranslates(t);
+}
+
 } /*namespace*/
 
 void
@@ -142,6 +296,12 @@ GusdUSD_XformCache::_GetLocalTransformation(const UsdPrim& prim,
            Key off of time=0 instead.*/
         time = UsdTimeCode(0.0);
     }
+    if(_interpolateSamples && !time.IsDefault() &&
+       info->LocalXformIsMaybeTimeVarying()) {
+        if(_InterpolateLocalTransformation(prim, time, xform, info))
+            return true;
+    }
+
     _VaryingKey key(GusdUSD_VaryingPropertyKey(prim, time));
 
     if(auto item = _xforms.findItem(key)) {
@@ -160,36 +320,95 @@ GusdUSD_XformCache::_GetLocalTransformation(const UsdPrim& prim,
 
 
 bool
-GusdUSD_XformCache::GetLocalToWorldTransform(const UsdPrim& prim,
-                                             UsdTimeCode time,
-                                             UT_Matrix4D& xform)
+GusdUSD_XformCache::_InterpolateLocalTransformation(
+    const UsdPrim& prim,
+    UsdTimeCode time,
+    UT_Matrix4D& xform,
+    const XformInfoHandle& info)
 {
-    const auto info = GetXformInfo(prim);
-    if(ARCH_UNLIKELY(!info)) {
-        return false;
+    _UnvaryingKey key((GusdUSD_UnvaryingPropertyKey(prim)));
+
+    _XformSamplesItemHandle samples;
+    if(auto item = _xformSamples.findItem(key)) {
+        samples.reset(UTverify_cast<const _XformSamplesItem*>(item.get()));
+    } else {
+        auto* newSamples = new _XformSamplesItem;
+        newSamples->Init(info->query,
+                         prim.GetStage()->GetInterpolationType() ==
+                         UsdInterpolationTypeHeld);
+        // Prims that can't be interpolated are stored too, so that
+        // the samples aren't queried again.
+        samples.reset(UTverify_cast<const _XformSamplesItem*>(
+                          _xformSamples.addItem(
+                              key, UT_CappedItemHandle(newSamples)).get()));
     }
+    if(samples->IsValid()) {
+        samples->Eval(time.GetValue(), xform);
+        return true;
+    }
+    return false;
+}
+
 
+UsdTimeCode
+GusdUSD_XformCache::_GetWorldXformKeyTime(const XformInfo& info,
+                                          UsdTimeCode time)
+{
     // See if we can remap the time to for unvarying xforms.
-    if(!time.IsDefault() && !info->WorldXformIsMaybeTimeVarying()) {
+    if(!time.IsDefault() && !info.WorldXformIsMaybeTimeVarying()) {
         /* XXX: we know we're not time varying, but that doesn't
            mean that we can key default, since there might still
            be a single varying value that we'd miss.
            Key off of time=0 instead.*/
-        time = UsdTimeCode(0.0);
+        return UsdTimeCode(0.0);
+    }
+    return time;
+}
+
+
+bool
+GusdUSD_XformCache::_ShouldCacheWorldXform(const XformInfo& info,
+                                           UsdTimeCode keyTime) const
+{
+    // When interpolating, sub-frame world transforms are cheap to rebuild
+    // from the interpolated local transforms, so only whole frames are
+    // cached, rather than adding entries for every sampled time.
+    return !_interpolateSamples || keyTime.IsDefault() ||
+           !info.WorldXformIsMaybeTimeVarying() ||
+           SYSisEqual(keyTime.GetValue(), SYSrint(keyTime.GetValue()));
+}
+
+
+bool
+GusdUSD_XformCache::GetLocalToWorldTransform(const UsdPrim& prim,
+                                             UsdTimeCode time,
+                                             UT_Matrix4D& xform)
+{
+    const auto info = GetXformInfo(prim);
+    if(ARCH_UNLIKELY(!info)) {
+        return false;
     }
+
+    time = _GetWorldXformKeyTime(*info, time);
+    const bool cacheWorldXform = _ShouldCacheWorldXform(*info, time);
+
     _VaryingKey key(GusdUSD_VaryingPropertyKey(prim, time));
 
-    if(auto item = _worldXforms.findItem(key)) {
-        xform = UTverify_cast<const _CappedXformItem*>(item.get())->xform;
-        return true;
+    if(cacheWorldXform) {
+        if(auto item = _worldXforms.findItem(key)) {
+            xform = UTverify_cast<const _CappedXformItem*>(item.get())->xform;
+            return true;
+        }
     }
     /* XXX: Race is possible when setting computed value,
        but it's preferable to have multiple threads compute the
        same thing than to cause lock contention.*/
     if(_GetLocalTransformation(prim, time, xform, info)) {
         if(ARCH_UNLIKELY(!info->HasParentXform())) {
-            _worldXforms.addItem(key, UT_CappedItemHandle(
-                                     new _CappedXformItem(xform)));
+            if(cacheWorldXform) {
+                _worldXforms.addItem(key, UT_CappedItemHandle(
+                                         new _CappedXformItem(xform)));
+            }
             return true;
         }
         const UsdPrim parent = prim.GetParent();
@@ -198,8 +417,10 @@ GusdUSD_XformCache::GetLocalToWorldTransform(const UsdPrim& prim,
         UT_Matrix4D parentXf;
         if(GetLocalToWorldTransform(parent, time, parentXf)) {
             xform *= parentXf;
-            _worldXforms.addItem(
-                key, UT_CappedItemHandle(new _CappedXformItem(xform)));
+            if(cacheWorldXform) {
+                _worldXforms.addItem(
+                    key, UT_CappedItemHandle(new _CappedXformItem(xform)));
+            }
             return true;
         }
     }
@@ -212,7 +433,12 @@ GusdUSD_XformCache::GusdUSD_XformCache(GusdStageCache& cache)
     : GusdUSD_DataCache(cache),
       _xforms(GUSDUT_USDCACHE_NAME, 512),
       _worldXforms(GUSDUT_USDCACHE_NAME, 512),
-      _xformInfos(GUSDUT_USDCACHE_NAME, 256) {}
+      _xformInfos(GUSDUT_USDCACHE_NAME, 256),
+      _xformSamples(GUSDUT_USDCACHE_NAME, 256),
+      _interpolateSamples(TfGetEnvSetting(GUSD_XFORMCACHE_INTERPOLATE))
+{
+    _TrackStageChanges();
+}
 
     
 GusdUSD_XformCache::GusdUSD_XformCache()
@@ -314,6 +540,8 @@ GusdUSD_XformCache::GetLocalTransformations(
     const GusdDefaultArray<UsdTimeCode>& times,
     UT_Matrix4D* xforms)
 {
+    TRACE_FUNCTION();
+
     return _ComputeXforms<_LocalXformFn>(_LocalXformFn(*this),
                                          prims, times, xforms);
 }
@@ -325,8 +553,202 @@ GusdUSD_XformCache::GetLocalToWorldTransforms(
     const GusdDefaultArray<UsdTimeCode>& times,
     UT_Matrix4D* xforms)
 {
-    return _ComputeXforms<_WorldXformFn>(_WorldXformFn(*this),
-                                         prims, times, xforms);
+    TRACE_FUNCTION();
+
+    if(prims.size() < 2) {
+        return _ComputeXforms<_WorldXformFn>(_WorldXformFn(*this),
+                                             prims, times, xforms);
+    }
+
+    // Sort the prims by time, so that each time can be processed as a batch.
+    UT_Array<exint> order;
+    order.setCapacity(prims.size());
+    for(exint i = 0; i < prims.size(); ++i) {
+        if(prims(i)) {
+            order.append(i);
+        } else {
+            xforms[i].identity();
+        }
+    }
+    if(!times.IsConstant()) {
+        UTparallelStableSort(order.begin(), order.end(),
+                             [&](exint a, exint b)
+                             { return times(a) < times(b); });
+    }
+
+    for(exint start = 0; start < order.size(); ) {
+        const UsdTimeCode time = times(order(start));
+        exint end = start+1;
+        while(end < order.size() && times(order(end)) == time)
+            ++end;
+
+        if(!_ComputeWorldXformsAtTime(prims, order.data()+start,
+                                      end-start, time, xforms)) {
+            return false;
+        }
+        start = end;
+    }
+    return true;
+}
+
+
+namespace {
+
+
+/** Node in the hierarchy of prims visited by batched world transforms.*/
+struct _WorldXformNode
+{
+    UsdPrim                                 prim;
+    GusdUSD_XformCache::XformInfoHandle     info;
+    /** Index of the node of the parent prim, or -1 if this node has no
+        parent transform, or if its world transform is already known.*/
+    exint                                   parent = -1;
+    /** Set once the world transform of the node is available.*/
+    bool                                    known = false;
+    /** Set if the world transform can't be computed.*/
+    bool                                    failed = false;
+};
+
+
+} /*namespace*/
+
+
+bool
+GusdUSD_XformCache::_ComputeWorldXformsAtTime(const UT_Array<UsdPrim>& prims,
+                                              const exint* indices,
+                                              exint count,
+                                              UsdTimeCode time,
+                                              UT_Matrix4D* xforms)
+{
+    UT_AutoInterrupt task("Compute world transforms");
+
+    // Gather the unique set of prims that need to be visited, walking up the
+    // hierarchy from each prim only until a node that was already visited,
+    // or whose world transform is available from the cache.
+    UT_Array<_WorldXformNode> nodes;
+    UT_Array<UT_Matrix4D> worldXforms;
+    UT_Array<exint> targetNodes;
+    targetNodes.setSizeNoInit(count);
+
+    UT_Map<SdfPath,exint,SdfPath::Hash> nodeMap;
+
+    for(exint i = 0; i < count; ++i) {
+        if(ARCH_UNLIKELY(!(i&1023) && task.wasInterrupted()))
+            return false;
+
+        exint child = -1;
+        for(UsdPrim prim = prims(indices[i]); ; prim = prim.GetParent()) {
+            const auto it = nodeMap.find(prim.GetPath());
+            if(it != nodeMap.end()) {
+                if(child >= 0)
+                    nodes(child).parent = it->second;
+                else
+                    targetNodes(i) = it->second;
+                break;
+            }
+
+            const exint idx = nodes.append();
+            worldXforms.append();
+            nodeMap.emplace(prim.GetPath(), idx);
+            if(child >= 0)
+                nodes(child).parent = idx;
+            else
+                targetNodes(i) = idx;
+
+            _WorldXformNode& node = nodes(idx);
+            node.prim = prim;
+            node.info = GetXformInfo(prim);
+            if(!node.info) {
+                node.failed = true;
+                break;
+            }
+
+            const UsdTimeCode keyTime =
+                _GetWorldXformKeyTime(*node.info, time);
+            if(_ShouldCacheWorldXform(*node.info, keyTime)) {
+                _VaryingKey key(GusdUSD_VaryingPropertyKey(prim, keyTime));
+                if(auto item = _worldXforms.findItem(key)) {
+                    worldXforms(idx) = UTverify_cast<const _CappedXformItem*>(
+                        item.get())->xform;
+                    node.known = true;
+                    break;
+                }
+            }
+            if(!node.info->HasParentXform())
+                break;
+            child = idx;
+        }
+    }
+
+    // Bucket the nodes by depth. Parents always have fewer path elements
+    // than their children, so processing each level after the one above
+    // it guarantees parents are finished first.
+    UT_Array<exint> order;
+    order.setSizeNoInit(nodes.size());
+    for(exint i = 0; i < nodes.size(); ++i)
+        order(i) = i;
+    UT_Array<size_t> depths;
+    depths.setSizeNoInit(nodes.size());
+    for(exint i = 0; i < nodes.size(); ++i)
+        depths(i) = nodes(i).prim.GetPath().GetPathElementCount();
+    std::stable_sort(order.begin(), order.end(),
+                     [&](exint a, exint b) { return depths(a) < depths(b); });
+
+    for(exint start = 0; start < order.size(); ) {
+        exint end = start+1;
+        while(end < order.size() && depths(order(end)) == depths(order(start)))
+            ++end;
+
+        UTparallelFor(
+            UT_BlockedRange<exint>(start, end),
+            [&](const UT_BlockedRange<exint>& r)
+            {
+                for(exint i = r.begin(); i < r.end(); ++i) {
+                    _WorldXformNode& node = nodes(order(i));
+                    if(node.known || node.failed)
+                        continue;
+
+                    UT_Matrix4D& xf = worldXforms(order(i));
+                    if(!_GetLocalTransformation(node.prim, time,
+                                                xf, node.info)) {
+                        node.failed = true;
+                        continue;
+                    }
+                    if(node.parent >= 0) {
+                        const _WorldXformNode& parent = nodes(node.parent);
+                        UT_ASSERT_P(parent.known || parent.failed);
+                        if(parent.failed) {
+                            node.failed = true;
+                            continue;
+                        }
+                        xf *= worldXforms(node.parent);
+                    }
+                    node.known = true;
+
+                    const UsdTimeCode keyTime =
+                        _GetWorldXformKeyTime(*node.info, time);
+                    if(_ShouldCacheWorldXform(*node.info, keyTime)) {
+                        _VaryingKey key(
+                            GusdUSD_VaryingPropertyKey(node.prim, keyTime));
+                        _worldXforms.addItem(
+                            key, UT_CappedItemHandle(new _CappedXformItem(xf)));
+                    }
+                }
+            });
+
+        if(task.wasInterrupted())
+            return false;
+        start = end;
+    }
+
+    for(exint i = 0; i < count; ++i) {
+        const exint idx = targetNodes(i);
+        if(nodes(idx).failed)
+            xforms[indices[i]].identity();
+        else
+            xforms[indices[i]] = worldXforms(idx);
+    }
+    return true;
 }
 
 
@@ -437,6 +859,7 @@ GusdUSD_XformCache::Clear()
     _xforms.clear();
     _worldXforms.clear();
     _xformInfos.clear();
+    _xformSamples.clear();
 }
 
 
@@ -445,7 +868,8 @@ namespace {
 
 template <typename KeyT>
 int64
-_RemoveKeysT(const UT_StringSet& paths, GusdUT_CappedCache& cache)
+_RemoveKeysT(const UT_StringSet& paths,
+             GusdUT_ShardedCappedCache& cache)
 {
     return cache.ClearEntries(
         [&](const UT_CappedKeyHandle& key,
@@ -458,6 +882,23 @@ _RemoveKeysT(const UT_StringSet& paths, GusdUT_CappedCache& cache)
 }
 
 
+template <typename KeyT>
+int64
+_RemoveSubtreeKeysT(const UsdStagePtr& stage,
+                    const SdfPathVector& subtrees,
+                    GusdUT_ShardedCappedCache& cache)
+{
+    return cache.ClearEntries(
+        [&](const UT_CappedKeyHandle& key,
+            const UT_CappedItemHandle& item) {
+
+        return GusdUSD_DataCache::ShouldClearPrim(
+            (*UTverify_cast<const KeyT*>(key.get()))->prim,
+            stage, subtrees);
+    });
+}
+
+
 } /*namespace*/
 
 
@@ -466,7 +907,19 @@ GusdUSD_XformCache::Clear(const UT_StringSet& paths)
 {   
     return _RemoveKeysT<_VaryingKey>(paths, _xforms) +
            _RemoveKeysT<_VaryingKey>(paths, _worldXforms ) +
-           _RemoveKeysT<_UnvaryingKey>(paths, _xformInfos);
+           _RemoveKeysT<_UnvaryingKey>(paths, _xformInfos) +
+           _RemoveKeysT<_UnvaryingKey>(paths, _xformSamples);
+}
+
+
+int64
+GusdUSD_XformCache::ClearSubtrees(const UsdStagePtr& stage,
+                                  const SdfPathVector& subtrees)
+{
+    return _RemoveSubtreeKeysT<_VaryingKey>(stage, subtrees, _xforms) +
+           _RemoveSubtreeKeysT<_VaryingKey>(stage, subtrees, _worldXforms) +
+           _RemoveSubtreeKeysT<_UnvaryingKey>(stage, subtrees, _xformInfos) +
+           _RemoveSubtreeKeysT<_UnvaryingKey>(stage, subtrees, _xformSamples);
 }
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -63,7 +63,9 @@ public:
                 const GusdDefaultArray<UsdTimeCode>& times,
                 UT_Matrix4D* xfroms);
 
-    /** Compute multiple world transforms in parallel.*/
+    /** Compute multiple world transforms in parallel.
+        Prims are batched by time, and the transforms of ancestors shared
+        by any of the prims are only computed once.*/
     bool    GetLocalToWorldTransforms(
                 const UT_Array<UsdPrim>& prims,
                 const GusdDefaultArray<UsdTimeCode>& times,
@@ -125,12 +127,44 @@ public:
     GUSD_API
     XformInfoHandle GetXformInfo(const UsdPrim& prim);
 
+    /** Enable or disable interpolation of local transforms.
+        When enabled, the authored time samples of each time-varying
+        xformable are evaluated once, and transforms at other times are
+        interpolated from those samples, rather than creating a new cache
+        entry for every distinct time. This also means that world transforms
+        are only cached at whole frames. Interpolation happens on decomposed
+        translate/rotate/stretch components, so results between samples may
+        differ slightly from USD's own per-op interpolation.
+        The initial mode is set by the GUSD_XFORMCACHE_INTERPOLATE
+        env setting.*/
+    GUSD_API
+    void            SetInterpolateSamples(bool interpolate)
+                    { _interpolateSamples = interpolate; }
+
+    bool            GetInterpolateSamples() const
+                    { return _interpolateSamples; }
+
     GUSD_API
     void            Clear() override;
 
     GUSD_API
     int64           Clear(const UT_StringSet& paths) override;
 
+    GUSD_API
+    int64           ClearSubtrees(const UsdStagePtr& stage,
+                                  const SdfPathVector& subtrees) override;
+
+    const char*     GetName() const override
+                    { return "Transform Cache"; }
+
+    int64           GetMemoryUsage() const override
+                    {
+                        return _xforms.GetMemoryUsage() +
+                               _worldXforms.GetMemoryUsage() +
+                               _xformInfos.GetMemoryUsage() +
+                               _xformSamples.GetMemoryUsage();
+                    }
+
 private:
     bool    _GetLocalTransformation(const UsdPrim& prim,
                                     UsdTimeCode time,
@@ -139,8 +173,37 @@ private:
                                     
 
 
+    /** Try to interpolate the local transform of @a prim from its cached
+        time samples. Returns false if the prim's samples can't be used
+        for interpolation.*/
+    bool    _InterpolateLocalTransformation(const UsdPrim& prim,
+                                            UsdTimeCode time,
+                                            UT_Matrix4D& xform,
+                                            const XformInfoHandle& info);
+
+    /** Returns the time at which the world transform of a prim is keyed
+        on the cache, given the time at which it is being queried.*/
+    static UsdTimeCode  _GetWorldXformKeyTime(const XformInfo& info,
+                                              UsdTimeCode time);
+
+    /** Returns true if a world transform keyed at @a keyTime should
+        be stored on the cache.*/
+    bool    _ShouldCacheWorldXform(const XformInfo& info,
+                                   UsdTimeCode keyTime) const;
+
+    /** Compute world transforms for the prims at @a indices, which all
+        share the same @a time. Shared ancestors are only computed once,
+        top-down through the hierarchy.*/
+    bool    _ComputeWorldXformsAtTime(const UT_Array<UsdPrim>& prims,
+                                      const exint* indices,
+                                      exint count,
+                                      UsdTimeCode time,
+                                      UT_Matrix4D* xforms);
+
 private:
-    GusdUT_CappedCache  _xforms, _worldXforms, _xformInfos;
+    GusdUT_ShardedCappedCache   _xforms, _worldXforms, _xformInfos;
+    GusdUT_ShardedCappedCache   _xformSamples;
+    bool                        _interpolateSamples;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
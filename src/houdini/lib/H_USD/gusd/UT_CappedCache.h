@@ -31,10 +31,13 @@
 #include "pxr/pxr.h"
 
 #include <SYS/SYS_AtomicInt.h>
+#include <SYS/SYS_Math.h>
+#include <UT/UT_Array.h>
 #include <UT/UT_Assert.h>
 #include <UT/UT_CappedCache.h>
 #include <UT/UT_ConcurrentHashMap.h>
 #include <UT/UT_IntrusivePtr.h>
+#include <UT/UT_UniquePtr.h>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -185,6 +188,112 @@ GusdUT_CappedCache::ClearEntries(const MatchFn& matchFn)
    return freed;
 }
 
+
+/** Variant of GusdUT_CappedCache that distributes items over a number of
+    independent shards. Keys are hashed to a shard, and each shard has its
+    own LRU and locks, so threads accessing different keys rarely contend
+    with each other. The memory cap is split evenly across the shards,
+    so that the combined size of all shards never exceeds the cap of the
+    cache as a whole.*/
+class GusdUT_ShardedCappedCache
+{
+public:
+    static const int    DEFAULT_NUM_SHARDS = 16;
+
+    GusdUT_ShardedCappedCache(const char* name,
+                              int64 size_in_mb=32,
+                              int num_shards=DEFAULT_NUM_SHARDS);
+
+    GusdUT_ShardedCappedCache(const GusdUT_ShardedCappedCache&) = delete;
+    GusdUT_ShardedCappedCache&
+    operator=(const GusdUT_ShardedCappedCache&) = delete;
+
+    /// Access the shard holding \p key.
+    GusdUT_CappedCache&         GetShard(const UT_CappedKey& key)
+                                { return *_shards[_ShardIndex(key)]; }
+
+    UT_CappedItemHandle         findItem(const UT_CappedKey& key)
+                                { return GetShard(key).findItem(key); }
+
+    UT_CappedItemHandle         addItem(const UT_CappedKey& key,
+                                        const UT_CappedItemHandle& item)
+                                { return GetShard(key).addItem(key, item); }
+
+    template <typename Item>
+    UT_IntrusivePtr<const Item> Find(const UT_CappedKey& key)
+                                { return GetShard(key).Find<Item>(key); }
+
+    template <typename Item,typename Creator,typename... Args> 
+    UT_IntrusivePtr<const Item> FindOrCreate(const UT_CappedKey& key,
+                                             const Creator& creator,
+                                             Args&... args)
+                                {
+                                    return GetShard(key).FindOrCreate<Item>(
+                                        key, creator, args...);
+                                }
+
+    template <typename MatchFn>
+    int64                       ClearEntries(const MatchFn& matchFn)
+                                {
+                                    int64 freed = 0;
+                                    for(auto& shard : _shards)
+                                        freed += shard->ClearEntries(matchFn);
+                                    return freed;
+                                }
+
+    void                        clear()
+                                {
+                                    for(auto& shard : _shards)
+                                        shard->clear();
+                                }
+
+    int                         GetNumShards() const
+                                { return int(_shards.size()); }
+
+    /// Combined memory usage of all shards, in bytes.
+    int64                       GetMemoryUsage() const
+                                {
+                                    int64 mem = 0;
+                                    for(auto& shard : _shards)
+                                        mem += shard->getMemoryUsage();
+                                    return mem;
+                                }
+
+    /// Combined memory cap of all shards, in bytes.
+    int64                       GetMaxMemoryUsage() const
+                                { return _maxMemoryUsage; }
+
+private:
+    int                         _ShardIndex(const UT_CappedKey& key) const
+                                {
+                                    // Scramble the hash, since the shards'
+                                    // own tables also index by the low bits.
+                                    const uint32 h = uint32(key.getHash()) *
+                                                     uint32(2654435761u);
+                                    return int((h >> 16) % _shards.size());
+                                }
+
+    UT_Array<UT_UniquePtr<GusdUT_CappedCache> > _shards;
+    int64                                       _maxMemoryUsage;
+};
+
+
+inline
+GusdUT_ShardedCappedCache::GusdUT_ShardedCappedCache(const char* name,
+                                                     int64 size_in_mb,
+                                                     int num_shards)
+{
+    UT_ASSERT(num_shards > 0);
+    num_shards = SYSmax(num_shards, 1);
+
+    const int64 shard_size_in_mb = SYSmax(size_in_mb / num_shards, int64(1));
+    _maxMemoryUsage = shard_size_in_mb * num_shards * 1024 * 1024;
+
+    _shards.setCapacity(num_shards);
+    for(int i = 0; i < num_shards; ++i)
+        _shards.emplace_back(new GusdUT_CappedCache(name, shard_size_in_mb));
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
 
 #endif /*_GUSD_UT_CAPPEDCACHE_H_*/
@@ -37,6 +37,7 @@
 #include "pxr/base/gf/vec4f.h"
 
 #include <SYS/SYS_TypeTraits.h>
+#include <UT/UT_ParallelUtil.h>
 #include <UT/UT_VectorTypes.h>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -199,6 +200,15 @@ struct GusdUT_Gf
     static inline void Convert(const UT_QuaternionT<T>& from, GfVec4f& to);
     /// @}
 
+
+    /// Convert \p count scalars from \p src to \p dst with a static_cast.
+    /// The scalars are converted as one flat run that the compiler can
+    /// vectorize, and large arrays are split over threads. This is the
+    /// preferred path for converting whole attribute arrays of densely packed
+    /// tuples, such as fp64 points to fp32, or half precision primvars.
+    template <class FROM, class TO>
+    static inline void  ConvertScalars(const FROM* src, TO* dst, exint count);
+
 private:
     template <class T, class GFQUAT>
     static inline void _ConvertQuat(const GFQUAT& from, UT_QuaternionT<T>& to);
@@ -576,6 +586,23 @@ GusdUT_Gf::Convert(const UT_QuaternionT<T>& from, GfVec4f& to)
 }
 
 
+template <class FROM, class TO>
+void
+GusdUT_Gf::ConvertScalars(const FROM* src, TO* dst, exint count)
+{
+    UTparallelForLightItems(
+        UT_BlockedRange<exint>(0, count),
+        [src,dst](const UT_BlockedRange<exint>& r)
+        {
+            const FROM* s = src + r.begin();
+            TO* d = dst + r.begin();
+            for (exint i = 0, n = r.size(); i < n; ++i) {
+                d[i] = static_cast<TO>(s[i]);
+            }
+        });
+}
+
+
 #undef _GUSDUT_DECLARE_UNCASTABLE
 #undef _GUSDUT_DECLARE_PARTIAL_EQUIVALENCE
 #undef _GUSDUT_DECLARE_EQUIVALENCE
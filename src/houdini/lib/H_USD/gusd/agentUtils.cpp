@@ -27,6 +27,7 @@
 #include "GU_PackedUSD.h"
 #include "GU_USD.h"
 #include "stageCache.h"
+#include "USD_Utils.h"
 #include "UT_Gf.h"
 
 #include "pxr/base/gf/matrix4d.h"
@@ -275,13 +276,88 @@ GusdCreateAgentRig(const UT_StringHolder &name,
 
 namespace {
 
+/// Joint names and inverse bind transforms, converted to the form stored on
+/// capture attributes. These are built once per skeleton (or per distinct
+/// joint order) and shared by every shape bound to it.
+struct Gusd_CaptureRegions
+{
+    UT_StringArray                      myNames;
+    UT_Array<GEO_CaptureBoneStorage>    myBones;
+};
+
+void
+Gusd_InitCaptureRegions(Gusd_CaptureRegions &regions,
+                        const VtTokenArray &jointNames,
+                        const VtMatrix4dArray &inverseBindTransforms)
+{
+    const exint numJoints = jointNames.size();
+    UT_ASSERT(inverseBindTransforms.size() == jointNames.size());
+
+    regions.myNames.setSizeNoInit(numJoints);
+    regions.myBones.setSizeNoInit(numJoints);
+
+    const GfMatrix4d *xforms = inverseBindTransforms.cdata();
+    UTparallelForLightItems(
+        UT_BlockedRange<exint>(0, numJoints),
+        [&](const UT_BlockedRange<exint> &r)
+        {
+            for (exint i = r.begin(); i < r.end(); ++i)
+            {
+                regions.myNames[i] =
+                    GusdUSD_Utils::TokenToStringHolder(jointNames[i]);
+                regions.myBones[i].myXform = GusdUT_Gf::Cast(xforms[i]);
+            }
+        });
+}
+
+/// Get the capture regions in the joint order of \p skinningQuery.
+/// If the prim uses the skeleton's joint order, this returns
+/// \p skelRegions. Otherwise the regions are remapped into \p localRegions.
+const Gusd_CaptureRegions *
+Gusd_GetLocalCaptureRegions(const UsdSkelSkinningQuery &skinningQuery,
+                            const Gusd_CaptureRegions &skelRegions,
+                            Gusd_CaptureRegions &localRegions)
+{
+    const UsdSkelAnimMapperRefPtr &mapper = skinningQuery.GetMapper();
+    if (!mapper || mapper->IsIdentity())
+        return &skelRegions;
+
+    // Remap the skeleton's joint indices into the local order, and then
+    // gather the converted regions through them.
+    VtIntArray skelIndices(skelRegions.myNames.size());
+    std::iota(skelIndices.begin(), skelIndices.end(), 0);
+
+    VtIntArray localIndices;
+    const int unmapped = -1;
+    if (!mapper->Remap(skelIndices, &localIndices, 1, &unmapped))
+        return nullptr;
+
+    const exint numJoints = localIndices.size();
+    localRegions.myNames.setSize(numJoints);
+    localRegions.myBones.setSizeNoInit(numJoints);
+    for (exint i = 0; i < numJoints; ++i)
+    {
+        const int skelIdx = localIndices[i];
+        if (skelIdx >= 0)
+        {
+            localRegions.myNames[i] = skelRegions.myNames[skelIdx];
+            localRegions.myBones[i] = skelRegions.myBones[skelIdx];
+        }
+        else
+        {
+            localRegions.myNames[i] = UT_StringHolder::theEmptyString;
+            localRegions.myBones[i].myXform.identity();
+        }
+    }
+    return &localRegions;
+}
+
 GA_RWAttributeRef
 Gusd_AddCaptureAttribute(GEO_Detail &gd,
                          const int tupleSize,
-                         const VtMatrix4dArray &inverseBindTransforms,
-                         const VtTokenArray &jointNames)
+                         const Gusd_CaptureRegions &regions)
 {
-    const int numJoints = static_cast<int>(jointNames.size());
+    const int numJoints = static_cast<int>(regions.myNames.size());
 
     int regionsPropId = -1;
 
@@ -296,25 +372,20 @@ Gusd_AddCaptureAttribute(GEO_Detail &gd,
     {
         GEO_RWAttributeCapturePath jointPaths(&gd);
         for (int i = 0; i < numJoints; ++i)
-        {
-            // TODO: Elide the string copy.
-            jointPaths.setPath(i, jointNames[i].GetText());
-        }
+            jointPaths.setPath(i, regions.myNames[i].c_str());
     }
 
     // Store the inverse bind transforms of each joint.
+    for (int i = 0; i < numJoints; ++i)
     {
-        const GfMatrix4d *xforms = inverseBindTransforms.cdata();
-        for (int i = 0; i < numJoints; ++i)
-        {
-            GEO_CaptureBoneStorage r;
-            r.myXform = GusdUT_Gf::Cast(xforms[i]);
-
-            joints->setObjectValues(i, regionsPropId, r.floatPtr(),
-                                    GEO_CaptureBoneStorage::tuple_size);
-        }
+        joints->setObjectValues(i, regionsPropId,
+                                regions.myBones[i].floatPtr(),
+                                GEO_CaptureBoneStorage::tuple_size);
     }
 
+    const GA_AIFIndexPair *indexPair = captureAttr->getAIFIndexPair();
+    indexPair->setEntries(captureAttr, tupleSize);
+
     return captureAttr;
 }
 
@@ -322,8 +393,7 @@ bool
 Gusd_CreateRigidCaptureAttribute(
     GEO_Detail& gd,
     const UsdSkelSkinningQuery &skinningQuery,
-    const VtMatrix4dArray& inverseBindTransforms,
-    const VtTokenArray& jointNames)
+    const Gusd_CaptureRegions &regions)
 {
     TRACE_FUNCTION();
 
@@ -334,21 +404,33 @@ Gusd_CreateRigidCaptureAttribute(
     UT_ASSERT(indices_pv && weights_pv);
 
     const int tupleSize = skinningQuery.GetNumInfluencesPerComponent();
-    GA_RWAttributeRef captureAttr = Gusd_AddCaptureAttribute(
-        gd, tupleSize, inverseBindTransforms, jointNames);
 
+    // The influences are shared by every point, so read them once up front.
+    VtFloatArray weights;
+    VtIntArray indices;
+    UT_VERIFY(indices_pv.Get(&indices));
+    UT_VERIFY(weights_pv.Get(&weights));
+    if (indices.size() < size_t(tupleSize) ||
+        weights.size() < size_t(tupleSize)) {
+        GUSD_WARN().Msg("%s -- too few rigid joint influences.",
+                        skinningQuery.GetPrim().GetPath().GetText());
+        return false;
+    }
+
+    // Unused influences have both an index and weight of 0. Convert this
+    // back to an invalid index for the capture attribute.
+    UT_IntArray captureIndices(tupleSize, tupleSize);
+    for (int c = 0; c < tupleSize; ++c)
+        captureIndices[c] = (weights[c] == 0.0) ? -1 : indices[c];
+
+    GA_RWAttributeRef captureAttr = Gusd_AddCaptureAttribute(
+        gd, tupleSize, regions);
     const GA_AIFIndexPair* indexPair = captureAttr->getAIFIndexPair();
-    indexPair->setEntries(captureAttr, tupleSize);
 
     UTparallelFor(
         GA_SplittableRange(gd.getPointRange()),
         [&](const GA_SplittableRange& r)
         {
-            VtFloatArray weights;
-            VtIntArray indices;
-            UT_VERIFY(indices_pv.Get(&indices));
-            UT_VERIFY(weights_pv.Get(&weights));
-
             auto* boss = UTgetInterrupt();
             char bcnt = 0;
 
@@ -360,12 +442,8 @@ Gusd_CreateRigidCaptureAttribute(
 
                 for ( ; o < end; ++o) {
                     for (int c = 0; c < tupleSize; ++c) {
-                        // Unused influences have both an index and weight
-                        // of 0. Convert this back to an invalid index for
-                        // the capture attribute.
-                        indexPair->setIndex(
-                            captureAttr, o, c,
-                            (weights[c] == 0.0) ? -1 : indices[c]);
+                        indexPair->setIndex(captureAttr, o, c,
+                                            captureIndices[c]);
                         indexPair->setData(captureAttr, o, c, weights[c]);
                     }
                 }
@@ -383,8 +461,7 @@ Gusd_CreateRigidCaptureAttribute(
 bool
 Gusd_CreateVaryingCaptureAttribute(
     GEO_Detail& gd,
-    const VtMatrix4dArray& inverseBindTransforms,
-    const VtTokenArray& jointNames,
+    const Gusd_CaptureRegions& regions,
     bool deleteInfluencePrimvars=true)
 {
     TRACE_FUNCTION();
@@ -442,46 +519,15 @@ Gusd_CreateVaryingCaptureAttribute(
     }
 
     const int tupleSize = jointIndicesHnd.getTupleSize();
-    const int numJoints = static_cast<int>(jointNames.size());
-
-    int regionsPropId = -1;
 
     GA_RWAttributeRef captureAttr =
-        gd.addPointCaptureAttribute(GEO_Detail::geo_NPairs(tupleSize));
-    GA_AIFIndexPairObjects* joints =
-        GEO_AttributeCaptureRegion::getBoneCaptureRegionObjects(
-            captureAttr, regionsPropId);
-    joints->setObjectCount(numJoints);
-
-
-    // Set the names of each joint.
-    {
-        GEO_RWAttributeCapturePath jointPaths(&gd);
-        for (int i = 0; i < numJoints; ++i) {
-            // TODO: Elide the string copy.
-            jointPaths.setPath(i, jointNames[i].GetText());
-        }
-    }
-
-    // Store the inverse bind transforms of each joint.
-    {
-        const GfMatrix4d* xforms = inverseBindTransforms.cdata();
-        for (int i = 0; i < numJoints; ++i) {
-
-            GEO_CaptureBoneStorage r;
-            r.myXform = GusdUT_Gf::Cast(xforms[i]);
-
-            joints->setObjectValues(i, regionsPropId, r.floatPtr(),
-                                    GEO_CaptureBoneStorage::tuple_size);
-        }
-    }
+        Gusd_AddCaptureAttribute(gd, tupleSize, regions);
 
     // Copy weights and indices.
     const GA_AIFTuple* jointIndicesTuple = jointIndicesHnd->getAIFTuple();
     const GA_AIFTuple* jointWeightsTuple = jointWeightsHnd->getAIFTuple();
 
     const GA_AIFIndexPair* indexPair = captureAttr->getAIFIndexPair();
-    indexPair->setEntries(captureAttr, tupleSize);
 
     UTparallelFor(
         GA_SplittableRange(gd.getPointRange()),
@@ -548,6 +594,62 @@ Gusd_CreateVaryingCaptureAttribute(
 }
 
 
+/// Create the capture attribute for \p skinningQuery on \p gd, given
+/// regions converted in the Skeleton's joint order.
+bool
+Gusd_CreateCaptureAttribute(GEO_Detail &gd,
+                            const UsdSkelSkinningQuery &skinningQuery,
+                            const Gusd_CaptureRegions &skelRegions)
+{
+    // Convert joint names and bind transforms in Skeleton order to the order
+    // specified on this skinnable prim (if any).
+    Gusd_CaptureRegions localRegionsStorage;
+    const Gusd_CaptureRegions *localRegions = Gusd_GetLocalCaptureRegions(
+        skinningQuery, skelRegions, localRegionsStorage);
+    if (!localRegions)
+        return false;
+
+    if (skinningQuery.IsRigidlyDeformed())
+    {
+        return Gusd_CreateRigidCaptureAttribute(
+            gd, skinningQuery, *localRegions);
+    }
+    else
+    {
+        return Gusd_CreateVaryingCaptureAttribute(gd, *localRegions, true);
+    }
+}
+
+
+bool
+Gusd_ReadSkinnablePrim(GU_Detail& gd,
+                       const UsdSkelSkinningQuery& skinningQuery,
+                       const Gusd_CaptureRegions& skelRegions,
+                       UsdTimeCode time,
+                       const char* lod,
+                       GusdPurposeSet purpose,
+                       const GT_RefineParms* refineParms)
+{
+    TRACE_FUNCTION();
+
+    const GfMatrix4d geomBindTransform = skinningQuery.GetGeomBindTransform();
+    const UsdPrim &skinnedPrim = skinningQuery.GetPrim();
+    const char *primvarPattern = "Cd skel:jointIndices skel:jointWeights";
+    const UT_StringHolder &attributePattern = UT_StringHolder::theEmptyString;
+    // Not needed since st isn't in the primvar pattern.
+    const bool translateSTtoUV = false;
+    const UT_StringHolder &nonTransformingPrimvarPattern =
+        UT_StringHolder::theEmptyString;
+
+    return (GusdGU_USD::ImportPrimUnpacked(
+                gd, skinnedPrim, time, lod, purpose, primvarPattern,
+                attributePattern, translateSTtoUV,
+                nonTransformingPrimvarPattern,
+                &GusdUT_Gf::Cast(geomBindTransform), refineParms) &&
+            Gusd_CreateCaptureAttribute(gd, skinningQuery, skelRegions));
+}
+
+
 bool
 Gusd_ReadSkinnablePrims(const UsdSkelBinding& binding,
                         const VtTokenArray& jointNames,
@@ -570,6 +672,10 @@ Gusd_ReadSkinnablePrims(const UsdSkelBinding& binding,
 
     GusdErrorTransport errTransport;
 
+    // Convert the joints once, rather than for every shape.
+    Gusd_CaptureRegions skelRegions;
+    Gusd_InitCaptureRegions(skelRegions, jointNames, invBindTransforms);
+
     // Read in details for all skinning targets in parallel.
     UTparallelForEachNumber(
         numTargets,
@@ -599,10 +705,9 @@ Gusd_ReadSkinnablePrims(const UsdSkelBinding& binding,
 
                 const GU_DetailHandleAutoWriteLock gdl(gdh);
                 
-                if (GusdReadSkinnablePrim(
+                if (Gusd_ReadSkinnablePrim(
                         *gdl.getGdp(), binding.GetSkinningTargets()[i],
-                        jointNames, invBindTransforms,
-                        time, lod, purpose, sev, refineParms)) {
+                        skelRegions, time, lod, purpose, refineParms)) {
                     details[i] = gdh;
                 } else if (sev >= UT_ERROR_ABORT) {
                     return;
@@ -628,6 +733,32 @@ Gusd_InvertTransforms(TfSpan<GfMatrix4d> xforms)
 }
 
 
+bool
+Gusd_GetInverseBindTransforms(const UsdSkelSkeleton &skel,
+                              const VtTokenArray &joints,
+                              VtMatrix4dArray &invBindTransforms)
+{
+    if (!joints.empty() &&
+        !skel.GetBindTransformsAttr().Get(&invBindTransforms))
+    {
+        GUSD_WARN().Msg("%s -- no authored bindTransforms",
+                        skel.GetPrim().GetPath().GetText());
+        return false;
+    }
+
+    if (invBindTransforms.size() != joints.size())
+    {
+        GUSD_WARN().Msg("%s -- size of 'bindTransforms' [%zu] != "
+                        "size of 'joints' [%zu].",
+                        skel.GetPrim().GetPath().GetText(),
+                        invBindTransforms.size(), joints.size());
+        return false;
+    }
+    Gusd_InvertTransforms(invBindTransforms);
+    return true;
+}
+
+
 bool
 Gusd_ReadSkinnablePrims(const UsdSkelBinding& binding,  
                         UsdTimeCode time,
@@ -722,31 +853,48 @@ GusdCreateCaptureAttribute(GU_Detail &detail,
                            const VtTokenArray &jointNames,
                            const VtMatrix4dArray &invBindTransforms)
 {
-    // Convert joint names and bind transforms in Skeleton order to the order
-    // specified on this skinnable prim (if any).
-    VtTokenArray localJointNames = jointNames;
-    VtMatrix4dArray localInvBindTransforms = invBindTransforms;
-    if (skinningQuery.GetMapper()) {
-        if (!skinningQuery.GetMapper()->Remap(
-                jointNames, &localJointNames)) {
-            return false;
-        }
-        if (!skinningQuery.GetMapper()->Remap(
-                invBindTransforms, &localInvBindTransforms)) {
-            return false;
-        }
-    }
+    Gusd_CaptureRegions skelRegions;
+    Gusd_InitCaptureRegions(skelRegions, jointNames, invBindTransforms);
+    return Gusd_CreateCaptureAttribute(detail, skinningQuery, skelRegions);
+}
 
-    if (skinningQuery.IsRigidlyDeformed())
-    {
-        return Gusd_CreateRigidCaptureAttribute(
-            detail, skinningQuery, localInvBindTransforms, localJointNames);
-    }
-    else
-    {
-        return Gusd_CreateVaryingCaptureAttribute(
-            detail, localInvBindTransforms, localJointNames, true);
-    }
+bool
+GusdCreateCaptureAttributes(const UT_Array<GU_Detail *> &details,
+                            const UsdSkelBinding &binding,
+                            const VtTokenArray &jointNames,
+                            const VtMatrix4dArray &invBindTransforms)
+{
+    TRACE_FUNCTION();
+
+    const exint numTargets = binding.GetSkinningTargets().size();
+    UT_ASSERT(details.size() == numTargets);
+
+    Gusd_CaptureRegions skelRegions;
+    Gusd_InitCaptureRegions(skelRegions, jointNames, invBindTransforms);
+
+    // Each shape is independent, and the points of each shape are filled
+    // in parallel as well.
+    std::atomic_bool success(true);
+    UTparallelForEachNumber(
+        SYSmin(numTargets, details.size()),
+        [&](const UT_BlockedRange<exint> &r)
+        {
+            for (exint i = r.begin(); i < r.end(); ++i)
+            {
+                if (!details[i])
+                    continue;
+
+                if (!Gusd_CreateCaptureAttribute(
+                        *details[i], binding.GetSkinningTargets()[i],
+                        skelRegions))
+                {
+                    success = false;
+                    return;
+                }
+            }
+        });
+
+    return success;
 }
 
 bool
@@ -760,24 +908,10 @@ GusdReadSkinnablePrim(GU_Detail& gd,
                       UT_ErrorSeverity sev,
                       const GT_RefineParms* refineParms)
 {
-    TRACE_FUNCTION();
-
-    const GfMatrix4d geomBindTransform = skinningQuery.GetGeomBindTransform();
-    const UsdPrim &skinnedPrim = skinningQuery.GetPrim();
-    const char *primvarPattern = "Cd skel:jointIndices skel:jointWeights";
-    const UT_StringHolder &attributePattern = UT_StringHolder::theEmptyString;
-    // Not needed since st isn't in the primvar pattern.
-    const bool translateSTtoUV = false;
-    const UT_StringHolder &nonTransformingPrimvarPattern =
-        UT_StringHolder::theEmptyString;
-
-    return (GusdGU_USD::ImportPrimUnpacked(
-                gd, skinnedPrim, time, lod, purpose, primvarPattern,
-                attributePattern, translateSTtoUV,
-                nonTransformingPrimvarPattern,
-                &GusdUT_Gf::Cast(geomBindTransform), refineParms) &&
-            GusdCreateCaptureAttribute(
-                gd, skinningQuery, jointNames, invBindTransforms));
+    Gusd_CaptureRegions skelRegions;
+    Gusd_InitCaptureRegions(skelRegions, jointNames, invBindTransforms);
+    return Gusd_ReadSkinnablePrim(gd, skinningQuery, skelRegions,
+                                  time, lod, purpose, refineParms);
 }
 
 GU_AgentShapeLibPtr
@@ -873,23 +1007,8 @@ GusdForEachSkinnedPrim(const UsdSkelBinding &binding,
         return false;
 
     VtMatrix4dArray invBindTransforms;
-    if (!joints.empty() &&
-        !skel.GetBindTransformsAttr().Get(&invBindTransforms))
-    {
-        GUSD_WARN().Msg("%s -- no authored bindTransforms",
-                        skel.GetPrim().GetPath().GetText());
+    if (!Gusd_GetInverseBindTransforms(skel, joints, invBindTransforms))
         return false;
-    }
-
-    if (invBindTransforms.size() != joints.size())
-    {
-        GUSD_WARN().Msg("%s -- size of 'bindTransforms' [%zu] != "
-                        "size of 'joints' [%zu].",
-                        skel.GetPrim().GetPath().GetText(),
-                        invBindTransforms.size(), joints.size());
-        return false;
-    }
-    Gusd_InvertTransforms(invBindTransforms);
 
     // TODO - convert Gusd_ReadSkinnablePrims to reuse this method.
     const exint num_targets = binding.GetSkinningTargets().size();
@@ -938,4 +1057,15 @@ GusdGetJointNames(const UsdSkelSkeleton &skel, VtTokenArray &jointNames)
     return Gusd_GetJointNames(skel, joints, jointNames);
 }
 
+bool
+GusdGetInverseBindTransforms(const UsdSkelSkeleton &skel,
+                             VtMatrix4dArray &invBindTransforms)
+{
+    VtTokenArray joints;
+    skel.GetJointsAttr().Get(&joints);
+
+    invBindTransforms.clear();
+    return Gusd_GetInverseBindTransforms(skel, joints, invBindTransforms);
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -150,6 +150,17 @@ GusdCreateCaptureAttribute(GU_Detail &detail,
                            const VtTokenArray &jointNames,
                            const VtMatrix4dArray &invBindTransforms);
 
+/// Create the boneCapture attributes for all shapes of \p binding at once.
+/// \p details holds a detail for each of the binding's skinning targets,
+/// or null for targets that should not receive a capture attribute.
+/// The skeleton's joints are converted once and shared by all shapes,
+/// and the shapes are processed in parallel.
+GUSD_API bool
+GusdCreateCaptureAttributes(const UT_Array<GU_Detail *> &details,
+                            const UsdSkelBinding &binding,
+                            const VtTokenArray &jointNames,
+                            const VtMatrix4dArray &invBindTransforms);
+
 struct GUSD_API GusdSkinImportParms
 {
     UsdTimeCode myTime = UsdTimeCode::EarliestTime();
@@ -177,6 +188,12 @@ GusdForEachSkinnedPrim(const UsdSkelBinding &binding,
 GUSD_API bool
 GusdGetJointNames(const UsdSkelSkeleton &skel, VtTokenArray &jointNames);
 
+/// Returns the inverse of the skeleton's bind transforms, in the skeleton's
+/// joint order. This is the form expected by GusdCreateCaptureAttributes().
+GUSD_API bool
+GusdGetInverseBindTransforms(const UsdSkelSkeleton &skel,
+                             VtMatrix4dArray &invBindTransforms);
+
 PXR_NAMESPACE_CLOSE_SCOPE
 
 #endif // GUSD_AGENTUTILS_H
@@ -23,13 +23,312 @@
 //
 #include "boundsCache.h"
 
+#include "pxr/base/arch/fileSystem.h"
+#include "pxr/base/arch/hash.h"
+#include "pxr/base/tf/envSetting.h"
+#include "pxr/base/tf/stringUtils.h"
+#include "pxr/base/trace/trace.h"
+#include "pxr/usd/ar/resolver.h"
+#include "pxr/usd/ar/resolverContext.h"
+#include "pxr/usd/ar/resolverContextBinder.h"
+
+#include <UT/UT_FileUtil.h>
+#include <UT/UT_Lock.h>
+
+#include <fstream>
 #include <iostream>
+#include <memory>
+#include <sstream>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
 using std::cerr;
 using std::endl;
 
+
+TF_DEFINE_ENV_SETTING(GUSD_BOUNDSCACHE_DIR, "",
+                      "Directory of a persistent cache of the bounds of "
+                      "packed USD prims. When set, bounds computed for a "
+                      "stage are saved to a sidecar file per root layer, and "
+                      "reused in later sessions without opening the stage "
+                      "for as long as the root layer is unmodified.");
+
+namespace {
+
+// Upper limit on the number of bounds shared between threads per stage and
+// purposes. The table is flushed when it grows beyond this, which keeps
+// animated stages from accumulating bounds for every frame ever visited.
+const exint _MAX_SHARED_BOUNDS = 1 << 20;
+
+} /*namespace*/
+
+////////////////////////////////////////////////////////////////////////////////
+
+UsdGeomBBoxCache&
+GusdBoundsCache::Item::GetThreadCache(UsdTimeCode time)
+{
+    UT_UniquePtr<UsdGeomBBoxCache>& cache = threadCaches.get();
+    if( !cache ) {
+        cache.reset( new UsdGeomBBoxCache( time, purposes ));
+    } else {
+        cache->SetTime( time );
+    }
+    return *cache;
+}
+
+bool
+GusdBoundsCache::Item::FindBound(const BoundKey& key, GfBBox3d& bbox) const
+{
+    UT_AutoReadLock readLock(boundsLock);
+
+    auto it = bounds.find(key);
+    if( it != bounds.end() ) {
+        bbox = it->second;
+        return true;
+    }
+    return false;
+}
+
+void
+GusdBoundsCache::Item::AddBound(const BoundKey& key, const GfBBox3d& bbox)
+{
+    UT_AutoWriteLock writeLock(boundsLock);
+
+    if( bounds.size() >= _MAX_SHARED_BOUNDS ) {
+        bounds.clear();
+    }
+    bounds.emplace(key, bbox);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+/// Persistent cache of untransformed bounds, stored in a directory as one
+/// text file per root layer. The first line of each file records the path
+/// and modification time of the layer it was computed from; each following
+/// line holds a single bound. Bounds are appended as they are computed, so
+/// that multiple sessions can contribute to the same file.
+///
+/// The resolved path and modification time of each layer are looked up
+/// once, and then reused until Clear() is called, so that lookups don't hit
+/// the file system. Each layer has its own lock, so threads working on
+/// different stages don't wait on each other.
+class GusdBoundsCache::_DiskCache
+{
+public:
+    _DiskCache(const std::string& dir) : _dir(dir) {}
+
+    bool    Find(const UT_StringRef& fileName,
+                 const std::string& key,
+                 UT_BoundingBox& bounds);
+
+    void    Add(const UT_StringRef& fileName,
+                const std::string& key,
+                const UT_BoundingBox& bounds);
+
+    void    Clear()
+            {
+                UT_AutoLock lock(_lock);
+                _layers.clear();
+            }
+
+    static std::string  ComputeKey(const SdfPath& primPath,
+                                   UsdTimeCode time,
+                                   const TfTokenVector& purposes);
+
+private:
+    struct _LayerEntry
+    {
+        UT_Lock         lock;
+        ArResolverContext context;
+        bool            loaded = false;
+        /// Empty if the file could not be resolved to a file on disk.
+        std::string     layerPath;
+        std::string     cacheFile;
+        double          mtime = 0;
+        UT_Map<std::string,UT_BoundingBox> bounds;
+    };
+    using _LayerEntryPtr = std::shared_ptr<_LayerEntry>;
+
+    /// Returns the entry of a file, creating an unloaded one if needed.
+    /// Returns null if the file can't be on disk.
+    _LayerEntryPtr  _GetEntry(const UT_StringRef& fileName);
+
+    /// Load the entry if it isn't loaded yet. The entry's lock must be held.
+    /// Returns false if the file couldn't be resolved to a file on disk.
+    bool            _Load(const UT_StringRef& fileName, _LayerEntry& entry);
+
+    static const char* const _HEADER;
+
+    const std::string   _dir;
+    UT_Lock             _lock;
+    UT_Map<std::string,_LayerEntryPtr> _layers;
+};
+
+
+const char* const GusdBoundsCache::_DiskCache::_HEADER = "gusdbounds1";
+
+
+std::string
+GusdBoundsCache::_DiskCache::ComputeKey(const SdfPath& primPath,
+                                        UsdTimeCode time,
+                                        const TfTokenVector& purposes)
+{
+    // The key must not contain any whitespace, since it is written as the
+    // first token of a line. Prim paths and purposes never do.
+    std::string key = primPath.GetString();
+    key += '|';
+    key += time.IsDefault() ? std::string("default")
+                            : TfStringPrintf("%.17g", time.GetValue());
+    for (const TfToken& purpose : purposes) {
+        key += '|';
+        key += purpose.GetString();
+    }
+    return key;
+}
+
+
+GusdBoundsCache::_DiskCache::_LayerEntryPtr
+GusdBoundsCache::_DiskCache::_GetEntry(const UT_StringRef& fileName)
+{
+    if (!fileName.isstring() || fileName.startsWith("op:")) {
+        return nullptr;
+    }
+
+    // The same file name may resolve differently in different contexts, so
+    // the context is part of the key.
+    ArResolverContext context = ArGetResolver().GetCurrentContext();
+    std::string key = TfStringPrintf("%016llx|%s",
+        (unsigned long long)hash_value(context), fileName.c_str());
+
+    UT_AutoLock lock(_lock);
+
+    _LayerEntryPtr& entry = _layers[key];
+    if (!entry) {
+        entry = std::make_shared<_LayerEntry>();
+        entry->context = context;
+    }
+    return entry;
+}
+
+
+bool
+GusdBoundsCache::_DiskCache::_Load(const UT_StringRef& fileName,
+                                   _LayerEntry& entry)
+{
+    if (entry.loaded) {
+        return !entry.layerPath.empty();
+    }
+    entry.loaded = true;
+
+    // Resolve the root layer the same way GusdStageCache does when opening
+    // the stage, with the context of the lookup bound.
+    {
+        ArResolverContextBinder binder(entry.context);
+        entry.layerPath = ArGetResolver().Resolve(fileName.toStdString());
+    }
+    if (entry.layerPath.empty() ||
+        !ArchGetModificationTime(entry.layerPath.c_str(), &entry.mtime)) {
+        entry.layerPath.clear();
+        return false;
+    }
+
+    const std::string& layerPath = entry.layerPath;
+    entry.cacheFile = TfStringPrintf(
+        "%s/%016llx.bounds", _dir.c_str(),
+        (unsigned long long)ArchHash64(layerPath.c_str(), layerPath.size()));
+
+    std::ifstream file(entry.cacheFile);
+    if (file) {
+        std::string line;
+        if (std::getline(file, line)) {
+            std::istringstream header(line);
+            std::string tag, path;
+            double mtime = -1;
+            header >> tag >> mtime;
+            std::getline(header >> std::ws, path);
+
+            if (tag == _HEADER && mtime == entry.mtime && path == layerPath) {
+                std::string key;
+                fpreal64 v[6];
+                while (std::getline(file, line)) {
+                    std::istringstream record(line);
+                    if (record >> key >> v[0] >> v[1] >> v[2]
+                                      >> v[3] >> v[4] >> v[5]) {
+                        entry.bounds[key] = UT_BoundingBox(
+                            v[0], v[1], v[2], v[3], v[4], v[5]);
+                    }
+                }
+                return true;
+            }
+        }
+        file.close();
+    }
+
+    // The cache file is missing or stale. Start a new one.
+    if (!UT_FileUtil::makeDirs(_dir.c_str())) {
+        TF_WARN("Failed to create bounds cache dir '%s'", _dir.c_str());
+        return true;
+    }
+    std::ofstream out(entry.cacheFile, std::ios::out | std::ios::trunc);
+    if (out) {
+        out << _HEADER << ' '
+            << TfStringPrintf("%.17g", entry.mtime) << ' '
+            << layerPath << '\n';
+    }
+    return true;
+}
+
+
+bool
+GusdBoundsCache::_DiskCache::Find(const UT_StringRef& fileName,
+                                  const std::string& key,
+                                  UT_BoundingBox& bounds)
+{
+    _LayerEntryPtr entry = _GetEntry(fileName);
+    if (!entry) {
+        return false;
+    }
+
+    UT_AutoLock lock(entry->lock);
+    if (_Load(fileName, *entry)) {
+        auto it = entry->bounds.find(key);
+        if (it != entry->bounds.end()) {
+            bounds = it->second;
+            return true;
+        }
+    }
+    return false;
+}
+
+
+void
+GusdBoundsCache::_DiskCache::Add(const UT_StringRef& fileName,
+                                 const std::string& key,
+                                 const UT_BoundingBox& bounds)
+{
+    _LayerEntryPtr entry = _GetEntry(fileName);
+    if (!entry) {
+        return;
+    }
+
+    UT_AutoLock lock(entry->lock);
+    if (!_Load(fileName, *entry) || entry->bounds.contains(key)) {
+        return;
+    }
+    entry->bounds[key] = bounds;
+
+    // Write each record with a single append, so records from other
+    // sessions sharing the file don't get interleaved within a line.
+    const std::string record = key +
+        TfStringPrintf(" %.17g %.17g %.17g %.17g %.17g %.17g\n",
+                       bounds.xmin(), bounds.ymin(), bounds.zmin(),
+                       bounds.xmax(), bounds.ymax(), bounds.zmax());
+    std::ofstream out(entry->cacheFile, std::ios::out | std::ios::app);
+    if (out) {
+        out.write(record.c_str(), record.size());
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 /* static */ 
@@ -42,6 +341,51 @@ GusdBoundsCache::GetInstance()
 
 GusdBoundsCache::GusdBoundsCache() 
 {
+    const std::string dir = TfGetEnvSetting(GUSD_BOUNDSCACHE_DIR);
+    if( !dir.empty() ) {
+        m_diskCache.reset( new _DiskCache( dir ));
+    }
+}
+
+/* static */
+bool
+GusdBoundsCache::IsPersistentCacheEnabled()
+{
+    return !TfGetEnvSetting(GUSD_BOUNDSCACHE_DIR).empty();
+}
+
+bool
+GusdBoundsCache::FindPersistentBound(
+    const UT_StringRef &fileName,
+    const SdfPath &primPath,
+    UsdTimeCode time,
+    const TfTokenVector &includedPurposes,
+    UT_BoundingBox &bounds )
+{
+    if( !m_diskCache )
+        return false;
+
+    return m_diskCache->Find(
+        fileName,
+        _DiskCache::ComputeKey( primPath, time, includedPurposes ),
+        bounds );
+}
+
+void
+GusdBoundsCache::AddPersistentBound(
+    const UT_StringRef &fileName,
+    const SdfPath &primPath,
+    UsdTimeCode time,
+    const TfTokenVector &includedPurposes,
+    const UT_BoundingBox &bounds )
+{
+    if( !m_diskCache )
+        return;
+
+    m_diskCache->Add(
+        fileName,
+        _DiskCache::ComputeKey( primPath, time, includedPurposes ),
+        bounds );
 }
 
 GusdBoundsCache::~GusdBoundsCache()
@@ -86,6 +430,8 @@ GusdBoundsCache::_ComputeBound(
     ComputeFunc boundFunc,
     UT_BoundingBox &bounds )
 {
+    TRACE_FUNCTION();
+
     if( !prim.IsValid() )
         return false;
 
@@ -93,18 +439,38 @@ GusdBoundsCache::_ComputeBound(
 	    ? prim.GetStage()->GetRootLayer()->GetIdentifier()
 	    : prim.GetStage()->GetRootLayer()->GetRealPath() );
 
-    MapType::accessor accessor;
-    if( !m_map.find( accessor, Key( stageId, includedPurposes ))) {
-        m_map.insert( accessor, Key( stageId, includedPurposes ) );
-        accessor->second = new Item( time, includedPurposes );
+    // Only hold on to the map entry long enough to grab the item, so that
+    // threads computing bounds on the same stage don't block each other.
+    ItemHandle item;
+    {
+        const Key key( stageId, includedPurposes );
+
+        MapType::const_accessor constAccessor;
+        if( m_map.find( constAccessor, key )) {
+            item = constAccessor->second;
+        } else {
+            constAccessor.release();
+
+            UT_AutoReadLock mapLock(m_mapLock);
+            MapType::accessor accessor;
+            if( m_map.insert( accessor, key )) {
+                accessor->second = new Item( includedPurposes );
+            }
+            item = accessor->second;
+        }
     }
-    std::lock_guard<std::mutex> lock(accessor->second->lock);
-    UsdGeomBBoxCache& cache = accessor->second->bboxCache;
 
-    cache.SetTime( time );
+    const BoundKey boundKey( prim, time, boundFunc );
+
+    GfBBox3d primBBox;
+    if( !item->FindBound( boundKey, primBBox )) {
+        UsdGeomBBoxCache& cache = item->GetThreadCache( time );
 
-    // boundFunc is either ComputeWorldBound or ComputeLocalBound
-    GfBBox3d primBBox = (cache.*boundFunc)(prim);
+        // boundFunc is either ComputeWorldBound or ComputeLocalBound
+        primBBox = (cache.*boundFunc)(prim);
+
+        item->AddBound( boundKey, primBBox );
+    }
 
     if( !primBBox.GetRange().IsEmpty() ) 
     {
@@ -127,7 +493,30 @@ GusdBoundsCache::_ComputeBound(
 void
 GusdBoundsCache::Clear()
 {
-    m_map.clear();
+    {
+        UT_AutoWriteLock mapLock(m_mapLock);
+        m_map.clear();
+    }
+
+    // Reload persistent bounds on next access, in case files changed.
+    if( m_diskCache )
+        m_diskCache->Clear();
+}
+
+int64
+GusdBoundsCache::GetMemoryUsage() const
+{
+    int64 mem = 0;
+
+    UT_AutoWriteLock mapLock(m_mapLock);
+    for( auto const& entry : m_map ) {
+        const Item& item = *entry.second;
+        UT_AutoReadLock readLock(item.boundsLock);
+
+        mem += sizeof(Item) +
+               item.bounds.size() * (sizeof(BoundKey) + sizeof(GfBBox3d));
+    }
+    return mem;
 }
 
 int64 
@@ -135,6 +524,7 @@ GusdBoundsCache::Clear(const UT_StringSet& paths)
 {
     int64 freed = 0;
 
+    UT_AutoWriteLock mapLock(m_mapLock);
     UT_Array<Key> keys;
     for( auto const& entry : m_map ) {
         if( paths.contains( entry.first.path.GetString() ) ) {
@@ -28,12 +28,18 @@
 #include "pxr/usd/usd/prim.h"
 #include "pxr/usd/usdGeom/bboxCache.h"
 #include "pxr/base/tf/token.h"
+#include "pxr/usd/sdf/path.h"
 
 #include "USD_DataCache.h"
 
 #include <UT/UT_BoundingBox.h>
 #include <UT/UT_IntrusivePtr.h>
 #include <UT/UT_ConcurrentHashMap.h>
+#include <UT/UT_Map.h>
+#include <UT/UT_RWLock.h>
+#include <UT/UT_StringHolder.h>
+#include <UT/UT_ThreadSpecificValue.h>
+#include <UT/UT_UniquePtr.h>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -45,6 +51,11 @@ PXR_NAMESPACE_OPEN_SCOPE
 /// Unfortunaly UsdGeomBBoxCaches only store a single frame at
 /// a time. I considered creating a cache per frame but I thought
 /// that would defeat optimizations for non animated geometry.
+///
+/// UsdGeomBBoxCache is not thread safe, so rather than serializing all
+/// threads on a single cache, each thread computes bounds with its own
+/// UsdGeomBBoxCache. Computed bounds are published to a table shared by
+/// all threads, so work done by one thread is not repeated by the others.
 
 class GusdBoundsCache : public GusdUSD_DataCache {
 public:
@@ -65,10 +76,46 @@ public:
             const TfTokenVector &includedPurposes,
             UT_BoundingBox &bounds );
 
+    /// Look up the untransformed bound of the prim at \p primPath of the
+    /// stage for \p fileName in the persistent, on-disk bounds cache.
+    /// This does not open the stage, so it can be used to provide bounds
+    /// for unloaded prims.
+    /// The persistent cache is only enabled when GUSD_BOUNDSCACHE_DIR
+    /// is set. Entries are keyed by the resolved root layer path, its
+    /// modification time, the prim path, the time and the purposes. Note
+    /// that changes to layers other than the root layer are not detected.
+    /// The root layer is resolved and checked for modifications once, on
+    /// first use, and then again after Clear().
+    bool FindPersistentBound(
+            const UT_StringRef &fileName,
+            const SdfPath &primPath,
+            UsdTimeCode time,
+            const TfTokenVector &includedPurposes,
+            UT_BoundingBox &bounds );
+
+    /// Store an untransformed bound in the persistent bounds cache.
+    /// See FindPersistentBound().
+    void AddPersistentBound(
+            const UT_StringRef &fileName,
+            const SdfPath &primPath,
+            UsdTimeCode time,
+            const TfTokenVector &includedPurposes,
+            const UT_BoundingBox &bounds );
+
+    /// Returns true if the persistent bounds cache is enabled.
+    static bool IsPersistentCacheEnabled();
+
     void Clear() override;
     int64 Clear(const UT_StringSet& stageNames) override;
 
+    const char* GetName() const override { return "Bounds Cache"; }
+
+    /// Returns the memory of the bounds shared between threads. The memory
+    /// of the per-thread UsdGeomBBoxCaches can't be queried.
+    int64 GetMemoryUsage() const override;
+
 private:
+    class _DiskCache;
 
     // Key that hashes the stage file name and a set of purposes.
     struct Key 
@@ -106,18 +153,62 @@ private:
         std::size_t         hash;
     };
 
+    typedef GfBBox3d (UsdGeomBBoxCache::*ComputeFunc)(const UsdPrim& prim);
+
+    // Key of a computed bound in the shared bounds table.
+    struct BoundKey
+    {
+        BoundKey(const UsdPrim& prim, UsdTimeCode time, ComputeFunc func)
+            : prim(prim), time(time), func(func) {}
+
+        bool                operator==(const BoundKey& o) const
+                            { return prim == o.prim &&
+                                     time == o.time &&
+                                     func == o.func; }
+
+        struct Hash
+        {
+            std::size_t     operator()(const BoundKey& key) const
+                            {
+                                std::size_t h = hash_value(key.prim);
+                                BOOST_NS::hash_combine(h, key.time.GetValue());
+                                BOOST_NS::hash_combine(
+                                    h, key.func ==
+                                    &UsdGeomBBoxCache::ComputeWorldBound);
+                                return h;
+                            }
+        };
+
+        UsdPrim             prim;
+        UsdTimeCode         time;
+        ComputeFunc         func;
+    };
+
     struct Item : public UT_IntrusiveRefCounter<Item>
     {
-        Item( UsdTimeCode time, const TfTokenVector& includedPurposes ) 
-            : bboxCache( time, includedPurposes )
+        Item( const TfTokenVector& includedPurposes ) 
+            : purposes( includedPurposes )
         {
         }
-        
-        UsdGeomBBoxCache bboxCache;
-        std::mutex lock;
-    };
 
-    typedef GfBBox3d (UsdGeomBBoxCache::*ComputeFunc)(const UsdPrim& prim);
+        /// Return the bbox cache of the calling thread, set to \p time.
+        UsdGeomBBoxCache&   GetThreadCache(UsdTimeCode time);
+
+        /// Look up a previously published bound.
+        bool                FindBound(const BoundKey& key,
+                                      GfBBox3d& bbox) const;
+
+        /// Publish a bound to all threads.
+        void                AddBound(const BoundKey& key,
+                                     const GfBBox3d& bbox);
+
+        TfTokenVector       purposes;
+
+        UT_ThreadSpecificValue<UT_UniquePtr<UsdGeomBBoxCache>> threadCaches;
+
+        mutable UT_RWLock   boundsLock;
+        UT_Map<BoundKey,GfBBox3d,BoundKey::Hash> bounds;
+    };
 
     bool _ComputeBound(
             const UsdPrim &prim,
@@ -130,6 +221,14 @@ private:
 
     typedef UT_ConcurrentHashMap<Key,ItemHandle,Key::HashCmp> MapType;
     MapType   m_map;
+
+    /// The concurrent map can't be iterated while entries are added or
+    /// removed. Adding entries takes the read lock, so threads can still
+    /// add entries concurrently, while iterating or erasing the map takes
+    /// the write lock.
+    mutable UT_RWLock m_mapLock;
+
+    UT_UniquePtr<_DiskCache> m_diskCache;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -25,6 +25,7 @@
 #include "NURBSCurvesWrapper.h"
 
 #include "context.h"
+#include "GT_TopologyCache.h"
 #include "GT_VtArray.h"
 #include "tokens.h"
 #include "USD_XformCache.h"
@@ -255,9 +256,13 @@ GusdCurvesWrapper::refine(
     if(!countsAttr)
         return false;
 
+    // Share the counts array across frames with the same topology.
     VtIntArray usdCounts;
-    countsAttr.Get(&usdCounts, m_time);
-    auto gtVertexCounts = new GusdGT_VtArray<int32>( usdCounts );
+    GT_DataArrayHandle gtVertexCounts =
+        GusdGT_TopologyCache::GetInstance().GetIntArray(
+            countsAttr, m_time, usdCounts);
+    if(!gtVertexCounts)
+        return false;
 
     // point positions
     UsdAttribute pointsAttr = usdCurves.GetPointsAttr();
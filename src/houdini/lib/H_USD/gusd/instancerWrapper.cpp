@@ -43,11 +43,14 @@
 #include <UT/UT_Assert.h>
 #include <UT/UT_Matrix3.h>
 #include <UT/UT_Matrix4.h>
+#include <UT/UT_ParallelUtil.h>
 #include <UT/UT_Quaternion.h>
 #include <UT/UT_StringArray.h>
+#include <UT/UT_UniquePtr.h>
 
 #include "pxr/base/gf/quatf.h"
 #include "pxr/base/tf/pathUtils.h"
+#include "pxr/usd/sdf/changeBlock.h"
 
 #include <iostream>
 
@@ -87,17 +90,20 @@ SdfPath _rootPrimPath(const SdfPath path)
     return _rootPrimPath(path.GetParentPath());
 }
 
-void setAngularVelocity(GT_DataArrayHandle houWAttr, std::vector<fpreal32>& houWArray) {
+/// Return the angular velocities in \p houWAttr as an array in USD's units.
+GT_Real32Array* makeAngularVelocities(const GT_DataArrayHandle& houWAttr) {
     // Houdini stores angular velocity in radians per second.
     // USD is degrees per second
-    const GT_Size numVals = houWAttr->entries() * houWAttr->getTupleSize();
-    houWArray = std::vector<fpreal32>(numVals);
-    houWAttr->fillArray(houWArray.data(), 0, houWAttr->entries(), houWAttr->getTupleSize());
-    std::transform(
-        houWArray.begin(),
-        houWArray.end(),
-        houWArray.begin(),
-        std::bind1st(std::multiplies<fpreal32>(), 180.0 / M_PI));
+    const GT_Size numEntries = houWAttr->entries();
+    const int tupleSize = houWAttr->getTupleSize();
+    GT_Real32Array* houWArray = new GT_Real32Array(numEntries, tupleSize);
+    houWAttr->fillArray(houWArray->data(), 0, numEntries, tupleSize);
+
+    fpreal32* data = houWArray->data();
+    const fpreal32 toDegrees = 180.0 / M_PI;
+    for (GT_Size i = 0, n = numEntries * tupleSize; i < n; ++i)
+        data[i] *= toDegrees;
+    return houWArray;
 }
 
 void setTransformAttrsFromComponents(UsdAttribute& usdPositionAttr,
@@ -183,11 +189,8 @@ void setTransformAttrsFromComponents(UsdAttribute& usdPositionAttr,
 
     if(needsScale || needsRotation) {
 
-        UT_Vector3 defaultN(0,0,0);
-        UT_Vector3 scale, up, trans, pivot;
-        UT_Quaternion rot, orient;
-        float defaultScale = 1.0;
-        UT_Matrix4F instanceM;
+        const UT_Vector3 defaultN(0,0,0);
+        const float defaultScale = 1.0;
 
         const int numPoints = houPosAttr->entries();
 
@@ -211,52 +214,62 @@ void setTransformAttrsFromComponents(UsdAttribute& usdPositionAttr,
             houUniformScalesHandle = houUniformScales;
         }
 
-
-        for(std::size_t i=0; i<numPoints; ++i) {
-
-            if(houScaleArray)  scale.assign(&houScaleArray[i*3]);
-            if(houUpArray)     up.assign(&houUpArray[i*3]);
-            if(houTransArray)  trans.assign(&houTransArray[i*3]);
-            if(houPivotArray)  pivot.assign(&houPivotArray[i*3]);
-            if(houRotArray)    rot = UT_Quaternion(&houRotArray[i*4]);
-            if(houOrientArray) orient = UT_Quaternion(&houOrientArray[i*4]);
-
-            instanceM.instance(
-                UT_Vector3(&houPosArray[i*3]),
-                houNormalArray       ? UT_Vector3(&houNormalArray[i*3]) : defaultN,
-                houUniformScaleArray ? houUniformScaleArray[i] : defaultScale,
-                houScaleArray        ? &scale  : NULL,
-                houUpArray           ? &up     : NULL,
-                houRotArray          ? &rot    : NULL,
-                houTransArray        ? &trans  : NULL,
-                houOrientArray       ? &orient : NULL,
-                houPivotArray        ? &pivot  : NULL
-            );
-
-            // reusing rot & scale
-            UT_Matrix3F xform(instanceM);
-            xform.extractScales(scale);
-            if(houScales != NULL) {
-                houScales->setTuple(scale.data(), i);
-            }
-            else if(houUniformScales != NULL) {
-                houUniformScales->set(scale.x(), i, 0);
-                houUniformScales->set(scale.x(), i, 1);
-                houUniformScales->set(scale.x(), i, 2);
-            }
-            if(houRotations != NULL) {
-                // TODO clean this up
-                rot.updateFromRotationMatrix(xform);
-                GfQuatf gfRot(rot.w(), GfVec3f(rot.x(), rot.y(), rot.z()));
-                gfRot.Normalize();
-                // Houdini quaternions are i,j,k,w
-                rot.assign(gfRot.GetImaginary()[0],
-                           gfRot.GetImaginary()[1],
-                           gfRot.GetImaginary()[2],
-                           gfRot.GetReal());
-                houRotations->setTuple(rot.data(), i);
-            }
-        }
+        // Decompose every instance in a single sweep, writing the
+        // orientations and scales as they're produced. Each point only
+        // writes its own tuples, so the ranges can run in parallel.
+        UTparallelForLightItems(UT_BlockedRange<exint>(0, numPoints),
+            [&](const UT_BlockedRange<exint>& r)
+            {
+                UT_Vector3 scale, up, trans, pivot;
+                UT_Quaternion rot, orient;
+                UT_Matrix4F instanceM;
+
+                for(exint i = r.begin(); i < r.end(); ++i) {
+
+                    if(houScaleArray)  scale.assign(&houScaleArray[i*3]);
+                    if(houUpArray)     up.assign(&houUpArray[i*3]);
+                    if(houTransArray)  trans.assign(&houTransArray[i*3]);
+                    if(houPivotArray)  pivot.assign(&houPivotArray[i*3]);
+                    if(houRotArray)    rot = UT_Quaternion(&houRotArray[i*4]);
+                    if(houOrientArray) orient = UT_Quaternion(&houOrientArray[i*4]);
+
+                    instanceM.instance(
+                        UT_Vector3(&houPosArray[i*3]),
+                        houNormalArray       ? UT_Vector3(&houNormalArray[i*3]) : defaultN,
+                        houUniformScaleArray ? houUniformScaleArray[i] : defaultScale,
+                        houScaleArray        ? &scale  : NULL,
+                        houUpArray           ? &up     : NULL,
+                        houRotArray          ? &rot    : NULL,
+                        houTransArray        ? &trans  : NULL,
+                        houOrientArray       ? &orient : NULL,
+                        houPivotArray        ? &pivot  : NULL
+                    );
+
+                    // reusing rot & scale
+                    UT_Matrix3F xform(instanceM);
+                    xform.extractScales(scale);
+                    if(houScales != NULL) {
+                        houScales->setTuple(scale.data(), i);
+                    }
+                    else if(houUniformScales != NULL) {
+                        houUniformScales->set(scale.x(), i, 0);
+                        houUniformScales->set(scale.x(), i, 1);
+                        houUniformScales->set(scale.x(), i, 2);
+                    }
+                    if(houRotations != NULL) {
+                        // TODO clean this up
+                        rot.updateFromRotationMatrix(xform);
+                        GfQuatf gfRot(rot.w(), GfVec3f(rot.x(), rot.y(), rot.z()));
+                        gfRot.Normalize();
+                        // Houdini quaternions are i,j,k,w
+                        rot.assign(gfRot.GetImaginary()[0],
+                                   gfRot.GetImaginary()[1],
+                                   gfRot.GetImaginary()[2],
+                                   gfRot.GetReal());
+                        houRotations->setTuple(rot.data(), i);
+                    }
+                }
+            });
 
         GusdGT_Utils::setUsdAttribute(usdPositionAttr, houPosBuffer, time);
 
@@ -954,6 +967,17 @@ updateFromGTPrim(const GT_PrimitiveHandle& sourcePrim,
             m_usdPointInstancer.VisAllIds(ctxt.time);
         }
 
+        // Read the current indices before opening the change block, since
+        // reads inside the block don't see the composed result of its edits.
+        VtIntArray protoIndices;
+        m_usdPointInstancer.GetProtoIndicesAttr().Get(
+            &protoIndices, ctxt.time);
+
+        // Author the indices and all of the per-instance arrays as a single
+        // batch of changes. This is closed again before computing the extent,
+        // which needs to see the composed result.
+        UT_UniquePtr<SdfChangeBlock> changeBlock(new SdfChangeBlock);
+
         // Indices
         usdAttr = m_usdPointInstancer.GetProtoIndicesAttr();
 
@@ -1035,7 +1059,7 @@ updateFromGTPrim(const GT_PrimitiveHandle& sourcePrim,
             if (preOverlayProtoIndices.count(ctxt.time) > 0) {
                 usdProtoIndicies = preOverlayProtoIndices[ctxt.time];
             } else if (ctxt.granularity==GusdContext::PER_FRAME) {
-                m_usdPointInstancer.GetProtoIndicesAttr().Get(&usdProtoIndicies, ctxt.time);
+                usdProtoIndicies = protoIndices;
             }
 
             if (usdProtoIndicies.size() > 0) {
@@ -1066,6 +1090,10 @@ updateFromGTPrim(const GT_PrimitiveHandle& sourcePrim,
         // Set indicies array
         if(gotValidIndices && usdAttr) {
             GusdGT_Utils::setUsdAttribute(usdAttr, houAttr, ctxt.time);
+
+            // These are the indices the transforms below are written for.
+            protoIndices.assign(idxArray->data(),
+                            idxArray->data() + numPoints);
         }
 
         // When the instance has a transform, set everything here.
@@ -1075,7 +1103,8 @@ updateFromGTPrim(const GT_PrimitiveHandle& sourcePrim,
                               worldToLocal,
                               gtPointAttrs,
                               ctxt,
-                              sourcePrim);
+                              sourcePrim,
+                              protoIndices);
         }
         else {
             // For nativ houdini instancing with just attributes on a point.
@@ -1090,9 +1119,7 @@ updateFromGTPrim(const GT_PrimitiveHandle& sourcePrim,
             houAttr = sourcePrim->findAttribute("w", attrOwner, 0);
             usdAttr = m_usdPointInstancer.GetAngularVelocitiesAttr();
             if(houAttr && usdAttr) {
-                std::vector<fpreal32> wArray;
-                setAngularVelocity(houAttr, wArray);
-                houAttr.reset(new GT_Real32Array(wArray.data(), houAttr->entries() , houAttr->getTupleSize()));
+                houAttr.reset(makeAngularVelocities(houAttr));
                 GusdGT_Utils::setUsdAttribute(usdAttr, houAttr, ctxt.time);
             }
             UsdAttribute usdPositionAttr = m_usdPointInstancer.GetPositionsAttr();
@@ -1112,6 +1139,8 @@ updateFromGTPrim(const GT_PrimitiveHandle& sourcePrim,
             }
         }
     
+        changeBlock.reset();
+
         // extent ------------------------------------------------------------------
 
         VtVec3fArray extent(2);
@@ -1156,7 +1185,8 @@ updateFromGTPrim(const GT_PrimitiveHandle& sourcePrim,
 void GusdInstancerWrapper::setTransformAttrsFromMatrices(const UT_Matrix4D &worldToLocal,
                                    const GT_AttributeListHandle gtAttrs,
                                    GusdContext ctxt,
-                                   GT_PrimitiveHandle sourcePrim)
+                                   GT_PrimitiveHandle sourcePrim,
+                                   const VtIntArray &protoIndices)
 {
     // Create a map from TfToken to UsdAttribute for each one we want to set.
     std::map<TfToken, UsdAttribute> usdAttrMap;
@@ -1214,9 +1244,7 @@ void GusdInstancerWrapper::setTransformAttrsFromMatrices(const UT_Matrix4D &worl
         if ( preOverlayProtoIndices.count(time) > 0 ) {    
             numPoints = preOverlayProtoIndices[time].size();
         } else {
-            VtIntArray indices;
-            m_usdPointInstancer.GetProtoIndicesAttr().Get( &indices, time);
-            numPoints = indices.size();
+            numPoints = protoIndices.size();
         }
     } else {
         // Just write out a point instancer with the data provided by houdini.
@@ -1236,6 +1264,7 @@ void GusdInstancerWrapper::setTransformAttrsFromMatrices(const UT_Matrix4D &worl
 
     GT_Owner attrOwner = GT_OWNER_INVALID;
     GT_DataArrayHandle houVAttr = sourcePrim->findAttribute("v", attrOwner, 0);
+    GT_DataArrayHandle houVBuffer;
     const float *houVArray=NULL;
     GT_Real32Array* houVelocities=NULL;
     if(houVAttr && houVAttr->getTupleSize() == 3) {
@@ -1245,7 +1274,6 @@ void GusdInstancerWrapper::setTransformAttrsFromMatrices(const UT_Matrix4D &worl
         } else {
             // We have to construct the array point by point, in order to get
             // some data from the original point instancer.
-            GT_DataArrayHandle houVBuffer;
             houVArray = houVAttr->getF32Array(houVBuffer);
             houVelocities = new GT_Real32Array(numPoints, 3);
             houHandlesMap[UsdGeomTokens->velocities] = GT_DataArrayHandle(houVelocities);
@@ -1254,13 +1282,15 @@ void GusdInstancerWrapper::setTransformAttrsFromMatrices(const UT_Matrix4D &worl
 
     GT_DataArrayHandle houWAttr = sourcePrim->findAttribute("w", attrOwner, 0);
     GT_Real32Array* houAngularVelocities = NULL;
-    std::vector<fpreal32> houWArray;
+    GT_DataArrayHandle houWBuffer;
+    const fpreal32* houWArray = NULL;
     if (houWAttr && houWAttr->getTupleSize() == 3) {
-        setAngularVelocity(houWAttr, houWArray);
+        GT_Real32Array* houWDegrees = makeAngularVelocities(houWAttr);
+        houWBuffer = houWDegrees;
+        houWArray = houWDegrees->data();
         if (numPoints == numXforms) {
             // We can set it directly with no further calculations
-            houWAttr.reset(new GT_Real32Array(houWArray.data(), houWAttr->entries() , houWAttr->getTupleSize()));
-            houHandlesMap[UsdGeomTokens->angularVelocities] = houWAttr;
+            houHandlesMap[UsdGeomTokens->angularVelocities] = houWBuffer;
         } else {
             // We have to construct the array point by point, in order to get
             // some data from the original point instancer.
@@ -1269,64 +1299,90 @@ void GusdInstancerWrapper::setTransformAttrsFromMatrices(const UT_Matrix4D &worl
         }
     }
 
-
-
     // If we have transforms on prototypes, we have to remove them from our
     // final instance transformation, as the point instancer schema accounts
     // for prototype transforms. Will only be the case when writing out new
     // prototypes (new geom or overlay all).
-    VtIntArray indices;
-    m_usdPointInstancer.GetProtoIndicesAttr().Get( &indices, time);
-    bool removeProtoTransforms = (indices.size() == numXforms) &&
+    bool removeProtoTransforms = (protoIndices.size() == numXforms) &&
                                  (m_prototypeTransforms.size() > 0);
 
-    for(int pt=0; pt<numPoints; ++pt) {
+    const bool partial = (numPoints != numXforms);
+
+    // Decompose Houdini's transform \p i into the components of point \p pt.
+    // Each point only writes its own tuples, so this is safe to call for
+    // different points concurrently.
+    auto decomposeXform = [&](int pt, int i)
+    {
+        // Build a 4x4 that represents this instance transformation.
+        // Bring this into local space and then take the 3x3 from the upper left.
+        UT_Matrix4D instXform( 
+            houXformArray[i*16],    houXformArray[i*16+1],  houXformArray[i*16+2],  houXformArray[i*16+3],
+            houXformArray[i*16+4],  houXformArray[i*16+5],  houXformArray[i*16+6],  houXformArray[i*16+7],
+            houXformArray[i*16+8],  houXformArray[i*16+9],  houXformArray[i*16+10], houXformArray[i*16+11],
+            houXformArray[i*16+12], houXformArray[i*16+13], houXformArray[i*16+14], houXformArray[i*16+15] );
+
+        UT_Matrix4D localInstXform = instXform * worldToLocal;
+        // Multiply by the prototype inverse to "subtract" its transformation
+        if (removeProtoTransforms) {
+            int protoIdx = protoIndices[i];
+            UT_Matrix4D protoXform = m_prototypeTransforms[protoIdx];
+            protoXform.invert();
+            localInstXform =  protoXform * localInstXform;
+        }
         UT_Vector3 position;
         UT_Vector3 scale;
         UT_Quaternion q;
-        UT_Vector3 velocity;
-        UT_Vector3 angularVelocity;
-
-        if (numPoints == numXforms || instanceIndexMap.count((exint)pt)) {
-            // If all the data is from houdini, or this point is being overlaid,
-            // get the data from houdini.
-
-            int i = (numPoints == numXforms) ? pt : instanceIndexMap[pt];
-            // Build a 4x4 that represents this instance transformation.
-            // Bring this into local space and then take the 3x3 from the upper left.
-            UT_Matrix4D instXform( 
-                houXformArray[i*16],    houXformArray[i*16+1],  houXformArray[i*16+2],  houXformArray[i*16+3],
-                houXformArray[i*16+4],  houXformArray[i*16+5],  houXformArray[i*16+6],  houXformArray[i*16+7],
-                houXformArray[i*16+8],  houXformArray[i*16+9],  houXformArray[i*16+10], houXformArray[i*16+11],
-                houXformArray[i*16+12], houXformArray[i*16+13], houXformArray[i*16+14], houXformArray[i*16+15] );
-
-            UT_Matrix4D localInstXform = instXform * worldToLocal;
-            // Multiply by the prototype inverse to "subtract" its transformation
-            if (removeProtoTransforms) {
-                int protoIdx = indices[i];
-                UT_Matrix4D protoXform = m_prototypeTransforms[protoIdx];
-                protoXform.invert();
-                localInstXform =  protoXform * localInstXform;
+        localInstXform.getTranslates( position );
+        UT_Matrix3D localInstXform3( localInstXform );
+        localInstXform3.extractScales(scale);
+        q.updateFromRotationMatrix(localInstXform3);
+        q.normalize();
+
+        houPositions->setTuple( position.data(), pt );
+        houScales->setTuple(scale.data(), pt);
+        // Houdini quaternions are i,j,k,w
+        houRotations->setTuple(
+                UT_Vector4(q.x(), q.y(), q.z(), q.w()).data(), pt);
+
+        // We only reconstruct the data if we are doing a partial overlay.
+        if (partial) {
+            const UT_Vector3 zero(0, 0, 0);
+            if (houVelocities != NULL) {
+                houVelocities->setTuple(
+                    houVArray ? &houVArray[i*3] : zero.data(), pt);
             }
-            localInstXform.getTranslates( position );
-            UT_Matrix3D localInstXform3( localInstXform );
-            localInstXform3.extractScales(scale);
-            q.updateFromRotationMatrix(localInstXform3);
-            q.normalize();
-            // if partial mode
-            if (numPoints != numXforms ) {
-                if (houVArray) {
-                    velocity = UT_Vector3(houVArray[i*3],
-                                          houVArray[i*3+1],
-                                          houVArray[i*3+2]);
-                }
-                if (houWArray.size() >= numXforms * 3) {
-                    angularVelocity = UT_Vector3(houWArray[i*3],
-                                                 houWArray[i*3+1],
-                                                 houWArray[i*3+2]);
-                }
+            if (houAngularVelocities != NULL) {
+                houAngularVelocities->setTuple(
+                    houWAttr->entries() >= numXforms ? &houWArray[i*3]
+                                                     : zero.data(), pt);
             }
-        } else {
+        }
+    };
+
+    if (!partial) {
+        // All the data is from houdini, so every array can be filled in a
+        // single parallel sweep over the source matrices.
+        UTparallelForLightItems(UT_BlockedRange<int>(0, numPoints),
+            [&](const UT_BlockedRange<int>& r)
+            {
+                for (int pt = r.begin(); pt < r.end(); ++pt)
+                    decomposeXform(pt, pt);
+            });
+    } else {
+        for(int pt=0; pt<numPoints; ++pt) {
+            auto it = instanceIndexMap.find((exint)pt);
+            if (it != instanceIndexMap.end()) {
+                // This point is being overlaid, so get the data from houdini.
+                decomposeXform(pt, it->second);
+                continue;
+            }
+
+            UT_Vector3 position;
+            UT_Vector3 scale;
+            UT_Quaternion q;
+            UT_Vector3 velocity;
+            UT_Vector3 angularVelocity;
+
             // This point was in the original point instancer but not being
             // overlaid, so get original values. Only in an overlay transform.
 
@@ -1360,16 +1416,13 @@ void GusdInstancerWrapper::setTransformAttrsFromMatrices(const UT_Matrix4D &worl
                 m_preOverlayDataMap[token]).getPointValue(time, pt, ptAngularVelocity))
                 angularVelocity = GusdUT_Gf::Cast(ptAngularVelocity);
 
-        }
-        houPositions->setTuple( position.data(), pt );
+            houPositions->setTuple( position.data(), pt );
 
-        houScales->setTuple(scale.data(), pt);
-        // Houdini quaternions are i,j,k,w
-        houRotations->setTuple(
-                UT_Vector4(q.x(), q.y(), q.z(), q.w()).data(), pt);
+            houScales->setTuple(scale.data(), pt);
+            // Houdini quaternions are i,j,k,w
+            houRotations->setTuple(
+                    UT_Vector4(q.x(), q.y(), q.z(), q.w()).data(), pt);
 
-        // We only reconstruct the data if we are doing a partial overlay.
-        if (numPoints != numXforms ) {
             if (houVelocities != NULL)
                 houVelocities->setTuple(velocity.data(), pt);
             if (houAngularVelocities != NULL)
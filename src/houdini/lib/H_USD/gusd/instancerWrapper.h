@@ -116,10 +116,13 @@ private:
 
     void clearPreOverlayData();
 
+    /// \p protoIndices are the prototype indices of the instances, which
+    /// are passed in because this is called inside a change block.
     void setTransformAttrsFromMatrices(const UT_Matrix4D &worldToLocal,
                                    const GT_AttributeListHandle gtAttrs,
                                    GusdContext ctxt,
-                                   GT_PrimitiveHandle sourcePrim);
+                                   GT_PrimitiveHandle sourcePrim,
+                                   const VtIntArray &protoIndices);
 
     void addStandardAttribute(const UsdAttribute &attr,
                               const UT_StringHolder &attr_name,
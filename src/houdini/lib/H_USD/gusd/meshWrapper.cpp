@@ -24,10 +24,12 @@
 #include "meshWrapper.h"
 
 #include "context.h"
+#include "GT_TopologyCache.h"
 #include "GT_VtArray.h"
 #include "GU_USD.h"
 #include "tokens.h"
 #include "USD_XformCache.h"
+#include "UT_CappedCache.h"
 #include "UT_Gf.h"
 
 #include <GT/GT_DAConstant.h>
@@ -79,6 +81,77 @@ void _reverseWindingOrder(GT_Int32Array* indices,
     }
 }
 
+/// Key for the cache of winding order permutations. The permutation only
+/// depends on the face counts and the number of vertices.
+struct _WindingKey
+{
+    _WindingKey(const VtIntArray& counts, size_t numVertices)
+        : counts(counts), numVertices(numVertices)
+    {
+        hash = numVertices;
+        for (int c : counts) {
+            BOOST_NS::hash_combine(hash, c);
+        }
+    }
+
+    struct HashCmp
+    {
+        static std::size_t  hash(const _WindingKey& key)
+                            { return key.hash; }
+        // VtArray comparison is cheap when both arrays share their data,
+        // which is the common case for unchanged topology.
+        static bool         equal(const _WindingKey& a,
+                                  const _WindingKey& b)
+                            { return a.numVertices == b.numVertices &&
+                                     a.counts == b.counts; }
+    };
+
+    VtIntArray  counts;
+    size_t      numVertices;
+    size_t      hash;
+};
+
+typedef GusdUT_CappedKey<_WindingKey, _WindingKey::HashCmp> _WindingCappedKey;
+
+struct _WindingEntry : public UT_CappedItem
+{
+    _WindingEntry(const GT_DataArrayHandle& indirect) : indirect(indirect) {}
+
+    int64 getMemoryUsage() const override
+    {
+        return sizeof(*this) + indirect->getMemoryUsage();
+    }
+
+    GT_DataArrayHandle indirect;
+};
+
+/// Returns a permutation of [0, numVertices) that reverses the winding
+/// order of each face. This can be used as the indirect array of a
+/// GT_DAIndirect to view vertex lists and vertex attributes in Houdini's
+/// winding order, without copying them. The permutations are cached,
+/// so meshes and frames that share topology also share the permutation.
+GT_DataArrayHandle _getWindingIndirect(const VtIntArray& usdCounts,
+                                       size_t numVertices)
+{
+    static GusdUT_CappedCache theCache("GusdMeshWrapper windings", 256);
+
+    _WindingCappedKey key(_WindingKey(usdCounts, numVertices));
+
+    auto entry = theCache.FindOrCreate<_WindingEntry>(key,
+        [&]() -> UT_IntrusivePtr<UT_CappedItem> {
+            GT_Int32Array* indirect = new GT_Int32Array(numVertices, 1);
+            GT_DataArrayHandle indirectHandle(indirect);
+            int32* data = indirect->data();
+            for (size_t i = 0; i < numVertices; ++i) {
+                data[i] = i;
+            }
+            _reverseWindingOrder(indirect,
+                                 new GusdGT_VtArray<int32>(usdCounts));
+            return new _WindingEntry(indirectHandle);
+        });
+    return entry ? entry->indirect : GT_DataArrayHandle();
+}
+
 void _validateAttrData(
         const char*             destName, // The Houdni name of the attribute
         const char*             srcName,  // The USD name of the attribute
@@ -268,12 +341,16 @@ GusdMeshWrapper::refine(
         return false;
     }
 
+    // Topology is fetched through the topology cache, so that frames with
+    // the same topology share the same GT arrays.
+    GusdGT_TopologyCache& topologyCache = GusdGT_TopologyCache::GetInstance();
+
     VtIntArray usdCounts;
-    countsAttr.Get(&usdCounts, m_time);
-    if( usdCounts.size() < 1 ) {
+    GT_DataArrayHandle gtVertexCounts =
+        topologyCache.GetIntArray(countsAttr, m_time, usdCounts);
+    if( !gtVertexCounts || usdCounts.size() < 1 ) {
         return false;
     }
-    GT_DataArrayHandle gtVertexCounts = new GusdGT_VtArray<int32>( usdCounts );
     int numVerticiesExpected = std::accumulate( usdCounts.begin(), usdCounts.end(), 0 );
 
     // vertex indices
@@ -284,7 +361,8 @@ GusdMeshWrapper::refine(
         return false;
     }
     VtIntArray usdFaceIndex;
-    faceIndexAttr.Get(&usdFaceIndex, m_time);
+    GT_DataArrayHandle gtIndicesHandle =
+        topologyCache.GetIntArray(faceIndexAttr, m_time, usdFaceIndex);
     if( usdFaceIndex.size() < numVerticiesExpected ) {
         TF_WARN( "Invalid topology found for %s. "
                  "Expected at least %d verticies and only got %zd.",
@@ -292,16 +370,13 @@ GusdMeshWrapper::refine(
         return false;
     }
 
-    GT_DataArrayHandle gtIndicesHandle;
+    // The vertex list shares the USD array. If the winding order needs to be
+    // reversed, it is viewed through a (cached) permutation rather than
+    // copied, and the same permutation is used for vertex attributes below.
+    GT_DataArrayHandle windingIndirect;
     if( reverseWindingOrder ) {
-        // Make a copy and reorder
-        gtIndicesHandle = new GT_Int32Array(usdFaceIndex.cdata(),
-                            usdFaceIndex.size(), 1);
-        _reverseWindingOrder(UTverify_cast<GT_Int32Array*>(gtIndicesHandle.get()),
-                             gtVertexCounts);
-    }
-    else {
-        gtIndicesHandle = new GusdGT_VtArray<int32>( usdFaceIndex );
+        windingIndirect = _getWindingIndirect(usdCounts, usdFaceIndex.size());
+        gtIndicesHandle = new GT_DAIndirect(windingIndirect, gtIndicesHandle);
     }
 
     // point positions
@@ -469,17 +544,8 @@ GusdMeshWrapper::refine(
 
     if( gtVertexAttrs->entries() > 0 ) {
         if( reverseWindingOrder ) {
-            // Construct an index array which will be used to lookup vertex
-            // attributes in the correct order.
-            GT_Int32Array* vertexIndirect
-                = new GT_Int32Array(gtIndicesHandle->entries(), 1);
-            GT_DataArrayHandle vertexIndirectHandle(vertexIndirect);
-            for(int i=0; i<gtIndicesHandle->entries(); ++i) {
-                vertexIndirect->set(i, i);
-            }
-            _reverseWindingOrder(vertexIndirect, gtVertexCounts );
-
-            gtVertexAttrs = gtVertexAttrs->createIndirect(vertexIndirect);
+            // Lookup vertex attributes in the reversed order.
+            gtVertexAttrs = gtVertexAttrs->createIndirect(windingIndirect);
         }
     }
 
@@ -1085,6 +1085,106 @@ Gusd_HasSchemaAttrib(const UsdPrimDefinition &prim_defn,
     return prim_defn.GetSpecType(attr_name) != SdfSpecTypeUnknown;
 }
 
+/// Prims with fewer elements than this convert their primvars serially,
+/// since the task overhead would outweigh the conversion itself.
+static const exint _PARALLEL_PRIMVAR_MIN_ELEMS = 5000;
+
+namespace {
+
+/// A primvar to be loaded by GusdPrimWrapper::loadPrimvars(), along with
+/// the results of its conversion.
+struct Gusd_PrimvarLoad
+{
+    Gusd_PrimvarLoad() = default;
+    Gusd_PrimvarLoad(const UsdGeomPrimvar& primvar,
+                     const UT_StringHolder& name)
+        : primvar(primvar), name(name) {}
+
+    UsdGeomPrimvar      primvar;
+    UT_StringHolder     name;
+
+    bool                hasValue = false;
+    TfToken             interpolation;
+    GT_DataArrayHandle  data;
+};
+
+/// Compute and convert the value of @a load's primvar.
+/// This only reads from the stage, so it can be run for many primvars
+/// of the same prim in parallel.
+void
+Gusd_LoadPrimvar(Gusd_PrimvarLoad& load, UsdTimeCode time,
+                 bool translateSTtoUV)
+{
+    const UsdGeomPrimvar& primvar = load.primvar;
+
+    // Compute the value before calling convertPrimvarData, so that
+    // we can distinguish between primvars with no authored value
+    // and primvars whose authored value can't be converted.
+    // Note that the 'authored' primvars above are only known to have
+    // scene description, and still may have no value!
+    VtValue val;
+    if (!primvar.ComputeFlattened(&val, time)) {
+        return;
+    }
+    load.hasValue = true;
+
+    TfToken interpolation = primvar.GetInterpolation();
+
+    // If this is a constant array and there is a ":lengths" array, convert
+    // the pair back to an array attribute.
+    // The lengths array has the appropriate interpolation type for the
+    // array attribute.
+    UsdGeomPrimvar lengths_pv;
+    VtValue lengths_val;
+    if (interpolation == UsdGeomTokens->constant)
+    {
+        TfToken lengths_pv_name(primvar.GetName().GetString() +
+                                _tokens->lengthsSuffix.GetString());
+        lengths_pv = UsdGeomPrimvar(
+            primvar.GetAttr().GetPrim().GetAttribute(lengths_pv_name));
+
+        if (lengths_pv && lengths_pv.ComputeFlattened(&lengths_val, time))
+            interpolation = lengths_pv.GetInterpolation();
+    }
+
+    GT_DataArrayHandle gtData;
+    if (!lengths_val.IsEmpty())
+    {
+        GT_DataArrayHandle flat_data =
+            GusdPrimWrapper::convertAttributeData(primvar, val);
+        GT_DataArrayHandle lengths_data =
+            GusdPrimWrapper::convertAttributeData(lengths_pv, lengths_val);
+
+        if (flat_data && lengths_data)
+            gtData = new GT_DAVaryingArray(flat_data, lengths_data);
+    }
+    else
+        gtData = GusdPrimWrapper::convertAttributeData(primvar, val);
+
+    if( !gtData )
+        return;
+
+    // If we're translating 'st' to 'uv', and 'st' has tuple size 2, expand
+    // out to the standard tuple size of 3 for 'uv'.
+    if (translateSTtoUV && load.name == GA_Names::uv) {
+        const GT_Storage storage = gtData->getStorage();
+
+        if (GTisFloat(storage) && gtData->getTupleSize() == 2) {
+            if (storage == GT_STORE_FPREAL16)
+                gtData = Gusd_ExpandSTToUV<fpreal16>(gtData);
+            else if (storage == GT_STORE_FPREAL32)
+                gtData = Gusd_ExpandSTToUV<fpreal32>(gtData);
+            else if (storage == GT_STORE_FPREAL64)
+                gtData = Gusd_ExpandSTToUV<fpreal64>(gtData);
+        }
+    }
+
+    load.interpolation = interpolation;
+    load.data = gtData;
+}
+
+} // namespace
+
 void
 GusdPrimWrapper::loadPrimvars( 
     const UsdPrimDefinition&  prim_defn,
@@ -1160,6 +1260,8 @@ GusdPrimWrapper::loadPrimvars(
     // Is it better to sort the attributes and build the attributes all at once.
 
     UT_StringArray constant_attribs;
+    UT_Array<Gusd_PrimvarLoad> primvarLoads;
+    primvarLoads.setCapacity(authoredPrimvars.size());
     for( const UsdGeomPrimvar &primvar : authoredPrimvars )
     {
         // The :lengths primvar for an array attribute is handled when the main
@@ -1199,47 +1301,32 @@ GusdPrimWrapper::loadPrimvars(
             continue;
         }
 
-        // Compute the value before calling convertPrimvarData, so that
-        // we can distinguish between primvars with no authored value
-        // and primvars whose authored value can't be converted.
-        // Note that the 'authored' primvars above are only known to have
-        // scene description, and still may have no value!
-        VtValue val;
-        if (!primvar.ComputeFlattened(&val, time)) {
-            continue;
-        }
-
-        TfToken interpolation = primvar.GetInterpolation();
-
-        // If this is a constant array and there is a ":lengths" array, convert
-        // the pair back to an array attribute.
-        // The lengths array has the appropriate interpolation type for the
-        // array attribute.
-        UsdGeomPrimvar lengths_pv;
-        VtValue lengths_val;
-        if (interpolation == UsdGeomTokens->constant)
-        {
-            TfToken lengths_pv_name(primvar.GetName().GetString() +
-                                    _tokens->lengthsSuffix.GetString());
-            lengths_pv = UsdGeomPrimvar(
-                primvar.GetAttr().GetPrim().GetAttribute(lengths_pv_name));
+        primvarLoads.append(Gusd_PrimvarLoad(primvar, name));
+    }
 
-            if (lengths_pv && lengths_pv.ComputeFlattened(&lengths_val, time))
-                interpolation = lengths_pv.GetInterpolation();
+    // Converting the primvars is independent for each primvar, so for
+    // prims with enough primvars and elements, do it in parallel.
+    const exint numElems = SYSmax(minUniform, minPoint, minVertex);
+    const auto loadRange = [&](const UT_BlockedRange<exint>& r) {
+        for (exint i = r.begin(); i < r.end(); ++i) {
+            Gusd_LoadPrimvar(primvarLoads(i), time, translateSTtoUV);
         }
+    };
+    const UT_BlockedRange<exint> loadRng(0, primvarLoads.size());
+    if (primvarLoads.size() > 1 && numElems >= _PARALLEL_PRIMVAR_MIN_ELEMS) {
+        UTparallelFor(loadRng, loadRange, 1, 1);
+    } else {
+        loadRange(loadRng);
+    }
 
-        GT_DataArrayHandle gtData;
-        if (!lengths_val.IsEmpty())
-        {
-            GT_DataArrayHandle flat_data = convertAttributeData(primvar, val);
-            GT_DataArrayHandle lengths_data =
-                convertAttributeData(lengths_pv, lengths_val);
+    for (const Gusd_PrimvarLoad& load : primvarLoads)
+    {
+        const UsdGeomPrimvar& primvar = load.primvar;
+        const UT_StringHolder& name = load.name;
+        const GT_DataArrayHandle& gtData = load.data;
 
-            if (flat_data && lengths_data)
-                gtData = new GT_DAVaryingArray(flat_data, lengths_data);
-        }
-        else
-            gtData = convertAttributeData(primvar, val);
+        if (!load.hasValue)
+            continue;
 
         if( !gtData )
         {
@@ -1250,29 +1337,15 @@ GusdPrimWrapper::loadPrimvars(
             continue;
         }
 
-        // If we're translating 'st' to 'uv', and 'st' has tuple size 2, expand
-        // out to the standard tuple size of 3 for 'uv'.
-        if (translateSTtoUV && name == GA_Names::uv) {
-            const GT_Storage storage = gtData->getStorage();
-
-            if (GTisFloat(storage) && gtData->getTupleSize() == 2) {
-                if (storage == GT_STORE_FPREAL16)
-                    gtData = Gusd_ExpandSTToUV<fpreal16>(gtData);
-                else if (storage == GT_STORE_FPREAL32)
-                    gtData = Gusd_ExpandSTToUV<fpreal32>(gtData);
-                else if (storage == GT_STORE_FPREAL64)
-                    gtData = Gusd_ExpandSTToUV<fpreal64>(gtData);
-            }
-        }
-
         // Encode the USD primvar names into something safe for the Houdini
         // geometry attribute name. This allows round tripping of namespaced
         // primvars from USD -> Houdini -> USD.
         UT_StringHolder attrname = UT_VarEncode::encodeAttrib(name);
 
-        Gusd_AddAttribute(primvar, gtData, attrname, interpolation, minUniform,
-                          minPoint, minVertex, primPath, remapIndicies, vertex,
-                          point, primitive, constant, constant_attribs);
+        Gusd_AddAttribute(primvar, gtData, attrname, load.interpolation,
+                          minUniform, minPoint, minVertex, primPath,
+                          remapIndicies, vertex, point, primitive, constant,
+                          constant_attribs);
     }
 
     // Import custom attributes.
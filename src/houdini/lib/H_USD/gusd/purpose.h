@@ -42,6 +42,7 @@ enum GusdPurposeSet {
     GUSD_PURPOSE_PROXY =   0x02,
     GUSD_PURPOSE_RENDER =  0x04,
     GUSD_PURPOSE_GUIDE =   0x08,
+    GUSD_PURPOSE_ALL =     0x0f,
 };
 
 
@@ -85,6 +86,16 @@ GusdPurposeInSet( const TfToken& name, GusdPurposeSet set )
 }
 
 
+/// Returns true if @a set holds all purposes, in which case any
+/// prim's purpose is in the set, without needing to be read.
+GUSD_API
+inline bool
+GusdPurposeSetIsAll( GusdPurposeSet set )
+{
+    return (set&GUSD_PURPOSE_ALL) == GUSD_PURPOSE_ALL;
+}
+
+
 /// Create a purpose set from an array of purpose strings.
 /// @{
 GUSD_API
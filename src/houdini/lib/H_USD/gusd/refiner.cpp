@@ -37,8 +37,10 @@
 #include <GT/GT_GEOPrimPacked.h>
 #include <GT/GT_PrimInstance.h>
 #include <SYS/SYS_Types.h>
+#include <UT/UT_ParallelUtil.h>
 
 #include <iostream>
+#include <memory>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -89,6 +91,9 @@ GusdRefiner::GusdRefiner(
     , m_isTopLevel( true )
     , m_buildPointInstancer( false )
     , m_buildPrototypes( false )
+    , m_refinePartitionsInParallel( true )
+    , m_parentRecord( -1 )
+    , m_setPointInstancerType( false )
 {
 }
 
@@ -134,50 +139,112 @@ GusdRefiner::refineDetail(
     
     // Refine each geometry partition to prims that can be written to USD. 
     // The results are accumulated in buffer in the refiner.
+    if( m_refinePartitionsInParallel && m_isTopLevel &&
+        partitions.size() > 1 ) {
+        refinePartitionsInParallel( detail, partitions, refineParms );
+        return;
+    }
     for(vector<GA_Range>::const_iterator rangeIt=partitions.begin();
             rangeIt != partitions.end(); ++rangeIt) {
+        refineRange( detail, *rangeIt, refineParms );
+    }
+}
 
-        const GA_Range& range = *rangeIt;
+void
+GusdRefiner::refinePartitionsInParallel(
+    const GU_ConstDetailHandle&     detail,
+    const std::vector<GA_Range>&    partitions,
+    const GT_RefineParms&           refineParms )
+{
+    // Each partition is refined by its own refiner into its own collector,
+    // recording the calls made to the collector. Replaying those calls into
+    // our collector in partition order produces the same prims and unique
+    // names as refining all partitions serially.
+    const exint numPartitions = partitions.size();
+    std::vector<std::unique_ptr<GusdRefinerCollector>> collectors(
+        numPartitions );
+    std::vector<std::unique_ptr<GusdRefiner>> refiners( numPartitions );
+
+    UTparallelForEachNumber( numPartitions,
+                             [&]( const UT_BlockedRange<exint>& r )
+    {
+        for( exint i = r.begin(); i < r.end(); ++i ) {
+            collectors[i].reset( new GusdRefinerCollector );
+            collectors[i]->m_recordAdds = true;
+
+            refiners[i].reset( new GusdRefiner( *collectors[i],
+                                                m_pathPrefix,
+                                                m_pathAttrName,
+                                                m_localToWorldXform ));
+            GusdRefiner& refiner = *refiners[i];
+            refiner.m_refinePackedPrims = m_refinePackedPrims;
+            refiner.m_useUSDIntrinsicNames = m_useUSDIntrinsicNames;
+            refiner.m_forceGroupTopPackedPrim = m_forceGroupTopPackedPrim;
+            refiner.m_buildPointInstancer = m_buildPointInstancer;
+            refiner.m_buildPrototypes = m_buildPrototypes;
+            refiner.m_pointInstancerType = m_pointInstancerType;
+            refiner.m_writeCtrlFlags = m_writeCtrlFlags;
+            refiner.m_isTopLevel = m_isTopLevel;
+            refiner.m_parentRecord = m_parentRecord;
+            refiner.m_refineParms = refineParms;
+
+            refiner.refineRange( detail, partitions[i], refineParms );
+        }
+    });
+
+    for( exint i = 0; i < numPartitions; ++i ) {
+        m_collector.merge( *collectors[i] );
+        if( refiners[i]->m_setPointInstancerType ) {
+            m_pointInstancerType = refiners[i]->m_pointInstancerType;
+            m_setPointInstancerType = true;
+        }
+    }
+}
 
-        // Before we refine we need to decide if we want to coalesce packed
-        // fragments. We will coalesce unless we are writing transform
-        // overlays and the fragment has a name.
+void
+GusdRefiner::refineRange(
+    const GU_ConstDetailHandle& detail,
+    const GA_Range&             range,
+    const GT_RefineParms&       refineParms )
+{
+    // Before we refine we need to decide if we want to coalesce packed
+    // fragments. We will coalesce unless we are writing transform
+    // overlays and the fragment has a name.
 
-        GU_DetailHandleAutoReadLock detailLock( detail );
+    GU_DetailHandleAutoReadLock detailLock( detail );
 
-        bool overlayTransforms = false;
-        GA_AttributeOwner order[] = { GA_ATTRIB_PRIMITIVE, GA_ATTRIB_DETAIL };
-        const GA_Attribute *overTransformsAttr = 
-            detailLock->findAttribute( GUSD_OVERTRANSFORMS_ATTR, order, 2 );
-        if( overTransformsAttr ) {
-            GA_ROHandleI h( overTransformsAttr );
-            if( overTransformsAttr->getOwner() == GA_ATTRIB_DETAIL ) {
-                overlayTransforms = h.get( GA_Offset(0) );
-            }
-            else {
-                // assume all prims in the range have the same usdovertransforms
-                // attribute value
-                overlayTransforms = h.get( range.begin().getOffset() );
-            }
+    bool overlayTransforms = false;
+    GA_AttributeOwner order[] = { GA_ATTRIB_PRIMITIVE, GA_ATTRIB_DETAIL };
+    const GA_Attribute *overTransformsAttr = 
+        detailLock->findAttribute( GUSD_OVERTRANSFORMS_ATTR, order, 2 );
+    if( overTransformsAttr ) {
+        GA_ROHandleI h( overTransformsAttr );
+        if( overTransformsAttr->getOwner() == GA_ATTRIB_DETAIL ) {
+            overlayTransforms = h.get( GA_Offset(0) );
         }
-        if( overlayTransforms ) {
-            // prims must be named to overlay transforms
-            const GA_Attribute *primPathAttr = 
-                detailLock->findPrimitiveAttribute( GUSD_PRIMPATH_ATTR );
-            if( !primPathAttr ) {
-                overlayTransforms = false;
-            }
+        else {
+            // assume all prims in the range have the same usdovertransforms
+            // attribute value
+            overlayTransforms = h.get( range.begin().getOffset() );
         }
-        
-        GT_RefineParms newRefineParms( refineParms );
-        newRefineParms.setCoalesceFragments( m_refinePackedPrims && !overlayTransforms );
-
-        GT_PrimitiveHandle detailPrim
-                = GT_GEODetail::makeDetail( detail, &range);
-        if(detailPrim) {
-            detailPrim->refine(*this, &newRefineParms );
+    }
+    if( overlayTransforms ) {
+        // prims must be named to overlay transforms
+        const GA_Attribute *primPathAttr = 
+            detailLock->findPrimitiveAttribute( GUSD_PRIMPATH_ATTR );
+        if( !primPathAttr ) {
+            overlayTransforms = false;
         }
     }
+    
+    GT_RefineParms newRefineParms( refineParms );
+    newRefineParms.setCoalesceFragments( m_refinePackedPrims && !overlayTransforms );
+
+    GT_PrimitiveHandle detailPrim
+            = GT_GEODetail::makeDetail( detail, &range);
+    if(detailPrim) {
+        detailPrim->refine(*this, &newRefineParms );
+    }
 }
 
 const GusdRefiner::GprimArray&
@@ -294,6 +361,7 @@ GusdRefiner::addPrimitive( const GT_PrimitiveHandle& gtPrimIn )
                     packedUSD->getFileName(), instancerPrimPath).first) {
                     // Get the type name of the usd file to overlay
                     m_pointInstancerType = prim.GetTypeName();
+                    m_setPointInstancerType = true;
             
                     // Make sure to set buildPointInstancer to true if we are overlaying a
                     // point instancer
@@ -319,14 +387,20 @@ GusdRefiner::addPrimitive( const GT_PrimitiveHandle& gtPrimIn )
             // If given a prim path, pass it to the collector for a custom
             // usd scope. Otherwise pass an empty SdfPath.
             SdfPath instancerPrimPath;
+            exint instancerParent = -1;
             if( !primName.empty() ) {
                 instancerPrimPath = SdfPath(createPrimPath(primName));
+                instancerParent = parentRecord(primName);
             }
 
             if( auto packedUSD = dynamic_cast<const GusdGT_PackedUSD*>( gtPrim.get() )) {
                 // Point instancer from packed usd
-                instancerPrimPath = instancerPrimPath.IsEmpty() ? packedUSD->getSrcPrimPath() : instancerPrimPath;
-                m_collector.addInstPrim( instancerPrimPath, gtPrim );
+                if( instancerPrimPath.IsEmpty() ) {
+                    instancerPrimPath = packedUSD->getSrcPrimPath();
+                    instancerParent = -1;
+                }
+                m_collector.addInstPrim( instancerPrimPath, gtPrim, 0,
+                                         instancerParent );
                 return;
             }
             else if( gtPrim->getPrimitiveType() == GT_PRIM_INSTANCE ) {
@@ -339,7 +413,8 @@ GusdRefiner::addPrimitive( const GT_PrimitiveHandle& gtPrimIn )
                 // TODO: If we put all geometry packed prims here, then we break
                 // grouping prims for purpose
                 for( size_t i = 0; i < instPrim->entries(); ++i ) {
-                    m_collector.addInstPrim( instancerPrimPath, gtPrim, i );
+                    m_collector.addInstPrim( instancerPrimPath, gtPrim, i,
+                                             instancerParent );
                 }
                 return;
             }
@@ -441,6 +516,7 @@ GusdRefiner::addPrimitive( const GT_PrimitiveHandle& gtPrimIn )
                 newCtm = m* m_localToWorldXform;
 
                 SdfPath newPath = m_pathPrefix;
+                exint newParentRecord = m_parentRecord;
                 bool recurse = true;
 
                 if( primHasNameAttr || 
@@ -456,7 +532,10 @@ GusdRefiner::addPrimitive( const GT_PrimitiveHandle& gtPrimIn )
                                                 gtPrim,
                                                 newCtm,
                                                 purpose,
-                                                m_writeCtrlFlags );
+                                                m_writeCtrlFlags,
+                                                parentRecord(primName) );
+                    newParentRecord = 
+                        exint(m_collector.m_addRecords.size()) - 1;
             
                     // If we are just writing transforms and encounter a packed prim, we 
                     // just want to write it's transform and not refine it further.
@@ -473,6 +552,7 @@ GusdRefiner::addPrimitive( const GT_PrimitiveHandle& gtPrimIn )
                     childRefiner.m_refinePackedPrims = refinePackedPrims;
                     childRefiner.m_forceGroupTopPackedPrim = m_forceGroupTopPackedPrim;
                     childRefiner.m_isTopLevel = false;
+                    childRefiner.m_parentRecord = newParentRecord;
 
                     childRefiner.m_writeCtrlFlags = m_writeCtrlFlags;
                     childRefiner.m_writeCtrlFlags.update( geometry );
@@ -504,7 +584,8 @@ GusdRefiner::addPrimitive( const GT_PrimitiveHandle& gtPrimIn )
                          gtPrim,
                          newCtm,
                          purpose,
-                         m_writeCtrlFlags );
+                         m_writeCtrlFlags,
+                         parentRecord(primName) );
     }
     else {
         gtPrim->refine( *this, &m_refineParms );
@@ -513,6 +594,26 @@ GusdRefiner::addPrimitive( const GT_PrimitiveHandle& gtPrimIn )
 
 SdfPath
 GusdRefinerCollector::add( 
+    const SdfPath&              path,
+    bool                        addNumericSuffix,
+    GT_PrimitiveHandle          prim,
+    const UT_Matrix4D&          xform,
+    const TfToken &             purpose,
+    const GusdWriteCtrlFlags&   writeCtrlFlagsIn,
+    exint                       parentRecord )
+{
+    const SdfPath result = addUnique( path, addNumericSuffix, prim, xform,
+                                      purpose, writeCtrlFlagsIn );
+    if( m_recordAdds ) {
+        m_addRecords.push_back( AddRecord{ path, result, parentRecord,
+                                           addNumericSuffix, prim, xform,
+                                           purpose, writeCtrlFlagsIn } );
+    }
+    return result;
+}
+
+SdfPath
+GusdRefinerCollector::addUnique( 
     const SdfPath&              path,
     bool                        addNumericSuffix,
     GT_PrimitiveHandle          prim,
@@ -764,9 +865,46 @@ GusdRefinerCollector::finish( GusdRefiner& refiner )
     }
 }
 
+void
+GusdRefinerCollector::merge( const GusdRefinerCollector& other )
+{
+    UT_ASSERT( other.m_recordAdds );
+
+    // Paths assigned by this collector to each of the records of other.
+    std::vector<SdfPath> results( other.m_addRecords.size() );
+
+    auto remap = [&]( const SdfPath& path, exint parent )
+    {
+        if( parent < 0 )
+            return path;
+        return path.ReplacePrefix( other.m_addRecords[parent].result,
+                                   results[parent] );
+    };
+
+    for( size_t i = 0; i < other.m_addRecords.size(); ++i ) {
+        const AddRecord& r = other.m_addRecords[i];
+        results[i] = add( remap( r.path, r.parent ),
+                          r.addNumericSuffix,
+                          r.prim,
+                          r.xform,
+                          r.purpose,
+                          r.writeCtrlFlags );
+    }
+    for( const InstPrimRecord& r : other.m_instPrimRecords ) {
+        const SdfPath path = remap( r.path, r.parent );
+        addInstPrim( path, r.entry.prim, r.entry.index );
+    }
+}
+
 void 
-GusdRefinerCollector::addInstPrim( const SdfPath &path, GT_PrimitiveHandle p, int index )
+GusdRefinerCollector::addInstPrim( const SdfPath &path, GT_PrimitiveHandle p, int index,
+                                   exint parentRecord )
 {
+    if( m_recordAdds ) {
+        m_instPrimRecords.push_back( 
+            InstPrimRecord{ path, parentRecord, InstPrimEntry( p, index ) } );
+    }
+
     // When we are building point instancers, the refiner collects prims 
     // that can be instances until finish is called.
     //
@@ -154,6 +154,12 @@ public:
 
     GusdWriteCtrlFlags      m_writeCtrlFlags;
 
+    // If true, the partitions of the top level detail (split by the path
+    // attribute) are refined in parallel, each into its own collector.
+    // The results are merged in partition order, so they are the same as
+    // when refining serially.
+    bool                    m_refinePartitionsInParallel;
+
     /////////////////////////////////////////////////////////////////////////////
 
 private:
@@ -162,6 +168,26 @@ private:
     // modifying to be a valid Usd prim path.
     std::string createPrimPath( const std::string& primName);
 
+    // Returns the record of the collector add() call whose resulting path
+    // is the prefix of relative paths created from a prim name.
+    exint parentRecord( const std::string& primName ) const
+    {
+        return (!primName.empty() && primName[0] == '/')
+            ? -1 : m_parentRecord;
+    }
+
+    // Refine a single partition of a detail.
+    void refineRange(
+        const GU_ConstDetailHandle& detail,
+        const GA_Range&             range,
+        const GT_RefineParms&       refineParms );
+
+    // Refine partitions in parallel, then merge them into our collector.
+    void refinePartitionsInParallel(
+        const GU_ConstDetailHandle&     detail,
+        const std::vector<GA_Range>&    partitions,
+        const GT_RefineParms&           refineParms );
+
     // Place to collect refined prims
     GusdRefinerCollector&   m_collector;
 
@@ -179,6 +205,13 @@ private:
 
     // false if we have recursed into a packed prim.
     bool                    m_isTopLevel;
+
+    // The collector record of the group prim we are refining beneath,
+    // or -1 if m_pathPrefix didn't come from the collector.
+    exint                   m_parentRecord;
+
+    // true if m_pointInstancerType was set by a prim we refined.
+    bool                    m_setPointInstancerType;
 };
 
 // As we recurse down a packed prim hierarchy, we create a new refiner at each
@@ -212,16 +245,53 @@ public:
 
     ////////////////////////////////////////////////////////////////////////////
 
+    // Record of a call to add() or addInstPrim(), kept when m_recordAdds
+    // is set. parent is the record of the add() call whose result is the
+    // prefix of path, or -1.
+    struct AddRecord {
+        SdfPath             path;
+        SdfPath             result;
+        exint               parent;
+        bool                addNumericSuffix;
+        GT_PrimitiveHandle  prim;
+        UT_Matrix4D         xform;
+        TfToken             purpose;
+        GusdWriteCtrlFlags  writeCtrlFlags;
+    };
+    struct InstPrimRecord {
+        SdfPath             path;
+        exint               parent;
+        InstPrimEntry       entry;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////
+
     SdfPath add( 
         const SdfPath&              path,
         bool                        explicitPrimPath,
         GT_PrimitiveHandle          prim,
         const UT_Matrix4D&          xform,
         const TfToken &             purpose,
-        const GusdWriteCtrlFlags&   writeCtrlFlags );
+        const GusdWriteCtrlFlags&   writeCtrlFlags,
+        exint                       parentRecord=-1 );
 
     /// Add a prim to be added to a point instancer during finish
-    void addInstPrim( const SdfPath& path, GT_PrimitiveHandle p, int index=0 );
+    void addInstPrim( const SdfPath& path, GT_PrimitiveHandle p, int index=0,
+                      exint parentRecord=-1 );
+
+    /// Add a prim, making its path unique (see add()).
+    SdfPath addUnique( 
+        const SdfPath&              path,
+        bool                        addNumericSuffix,
+        GT_PrimitiveHandle          prim,
+        const UT_Matrix4D&          xform,
+        const TfToken &             purpose,
+        const GusdWriteCtrlFlags&   writeCtrlFlags );
+
+    /// Replay all recorded calls of @a other (which must have m_recordAdds
+    /// set) into this collector. Paths beneath groups added by @a other
+    /// are remapped to the unique names assigned by this collector.
+    void merge( const GusdRefinerCollector& other );
 
     // Complete refining all prims.
     // When constructing point instancers, the refiner/collector gathers and 
@@ -242,6 +312,13 @@ public:
     // sort the prims. If a prim does note have a srcPrimPath, it is added to 
     // a entry with a empty path.
     std::map<SdfPath,std::vector<InstPrimEntry>> m_instancePrims;
+
+    // If true, record calls to add() and addInstPrim(), so they can
+    // be merged into another collector.
+    bool m_recordAdds = false;
+
+    std::vector<AddRecord>      m_addRecords;
+    std::vector<InstPrimRecord> m_instPrimRecords;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
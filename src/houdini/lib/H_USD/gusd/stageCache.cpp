@@ -29,12 +29,15 @@
 #include <UT/UT_Exit.h>
 #include <UT/UT_Interrupt.h>
 #include <UT/UT_Lock.h>
+#include <UT/UT_Map.h>
 #include <UT/UT_ParallelUtil.h>
 #include <UT/UT_RWLock.h>
 #include <UT/UT_String.h>
 #include <UT/UT_StringHolder.h>
 #include <UT/UT_StringSet.h>
 #include <UT/UT_Thread.h>
+#include <UT/UT_ThreadSpecificValue.h>
+#include <UT/UT_UniquePtr.h>
 #include <UT/UT_WorkArgs.h>
 #include <UT/UT_WorkBuffer.h>
 
@@ -42,9 +45,11 @@
 #include "gusd/error.h"
 #include "gusd/USD_DataCache.h"
 
+#include "pxr/base/arch/fileSystem.h"
 #include "pxr/base/arch/hints.h"
 #include "pxr/base/tf/envSetting.h"
 #include "pxr/base/tf/notice.h"
+#include "pxr/base/trace/trace.h"
 #include "pxr/usd/ar/resolver.h"
 #include "pxr/usd/ar/resolverContext.h"
 #include "pxr/usd/ar/resolverContextBinder.h"
@@ -83,6 +88,30 @@ TF_DEFINE_ENV_SETTING(GUSD_STAGEMASK_ENABLE, true,
                       "(or other types of stage edits).");
 
 
+TF_DEFINE_ENV_SETTING(GUSD_STAGECACHE_BATCHED_OPEN, true,
+                      "When loading prims in batches, open the root layers of "
+                      "all distinct files up front and in parallel, then "
+                      "schedule each distinct stage on its own task. "
+                      "Disabling this falls back to opening stages from "
+                      "blocked ranges of the batch.");
+
+
+TF_DEFINE_ENV_SETTING(GUSD_STAGECACHE_MEMORY_BUDGET, 0,
+                      "Initial memory budget of stage caches, in megabytes. "
+                      "When the estimated memory of the cached stages exceeds "
+                      "this budget, the least recently used stages that are "
+                      "not referenced elsewhere are evicted. A value of zero "
+                      "disables eviction.");
+
+
+TF_DEFINE_ENV_SETTING(GUSD_STAGEMASK_SHARE_LAYERS, true,
+                      "Share the layers opened for masked stages across all "
+                      "masked stages of the same file. This ensures that the "
+                      "layers are only opened once per file, so that only "
+                      "the mask-specific composition runs for each new "
+                      "masked stage.");
+
+
 namespace {
 
 GusdLopStageResolver theLopStageResolver = nullptr;
@@ -230,7 +259,7 @@ struct _StageKeyHashCmp
                            _PointerTypesMatch(a.GetEdit(), b.GetEdit());
                 }
 
-    static bool hash(const _StageKey& key)
+    static size_t hash(const _StageKey& key)
                 {
                     size_t hash = SYShash(key.GetPath());
                     SYShashCombine(hash, key.GetOpts().GetHash());
@@ -241,6 +270,79 @@ struct _StageKeyHashCmp
 };
 
 
+/// Reader/writer lock that is split across a number of stripes.
+/// Readers only lock the stripe that their thread hashes to, while writers
+/// lock every stripe. Since cache readers are constructed very frequently,
+/// and from many threads at once, this keeps readers on different threads
+/// from contending on the cache line of a single lock.
+class _StripedRWLock
+{
+public:
+    static constexpr int theNumStripes = 16;
+
+    /// Acquire a shared lock, returning the stripe that must later be
+    /// passed to readUnlock().
+    int     readLock()
+            {
+                const int stripe = int(SYShash(UT_Thread::getMyThreadId()) %
+                                       theNumStripes);
+                UT_RWLock& lock = _stripes[stripe].lock;
+                if(!lock.tryReadLock()) {
+                    // Only contended locks are traced.
+                    TRACE_SCOPE("Wait for GusdStageCache read lock");
+                    lock.readLock();
+                }
+                return stripe;
+            }
+
+    void    readUnlock(int stripe)
+            {
+                UT_ASSERT_P(stripe >= 0 && stripe < theNumStripes);
+                _stripes[stripe].lock.readUnlock();
+            }
+
+    void    writeLock()
+            {
+                // Always lock in the same order to avoid deadlocks
+                // between writers.
+                for(auto& stripe : _stripes) {
+                    if(!stripe.lock.tryWriteLock()) {
+                        TRACE_SCOPE("Wait for GusdStageCache write lock");
+                        stripe.lock.writeLock();
+                    }
+                }
+            }
+
+    bool    tryWriteLock()
+            {
+                for(int i = 0; i < theNumStripes; ++i) {
+                    if(!_stripes[i].lock.tryWriteLock()) {
+                        while(i-- > 0)
+                            _stripes[i].lock.writeUnlock();
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+    void    writeUnlock()
+            {
+                for(auto& stripe : _stripes)
+                    stripe.lock.writeUnlock();
+            }
+
+private:
+    struct _Stripe
+    {
+        UT_RWLock   lock;
+        // Keep each stripe on its own cache line.
+        char        pad[64];
+    };
+
+    _Stripe _stripes[theNumStripes];
+};
+
+
 struct _SdfPathHashCmp
 {
     static bool     equal(const SdfPath& a, const SdfPath& b)
@@ -251,6 +353,16 @@ struct _SdfPathHashCmp
 };
 
 
+struct _StringHashCmp
+{
+    static bool     equal(const UT_StringHolder& a, const UT_StringHolder& b)
+                    { return a == b; }
+
+    static size_t   hash(const UT_StringHolder& str)
+                    { return str.hash(); }
+};
+
+
 /// Returns true if this is a valid prim path for referencing a prim on a stage.
 bool
 _IsValidPrimPath(const SdfPath& path)
@@ -284,6 +396,18 @@ public:
                                     UT_ErrorSeverity sev=UT_ERROR_ABORT);
 
     void            Clear() { _map.clear(); }
+
+    bool            IsEmpty() const { return _map.empty(); }
+
+    /// Count the number of references that this cache holds to each stage.
+    void            CountStageRefs(UT_Map<const UsdStage*,exint>& refs) const
+                    {
+                        for(const auto& pair : _map)
+                            ++refs[get_pointer(pair.second)];
+                    }
+
+    /// Remove all entries referencing any of \p stages.
+    void            RemoveStages(const UT_Set<const UsdStage*>& stages);
     
     /// Append all stages held by this cache to @a stages.
     void            GetStages(UT_Set<UsdStageRefPtr>& stages) const
@@ -330,9 +454,22 @@ private:
 class GusdStageCache::_Impl
 {
 public:
+    _Impl();
     ~_Impl();
 
-    UT_RWLock&      GetMapLock()    { return _mapLock; }
+    /// Lock of the maps. See _StripedRWLock::readLock() for the
+    /// meaning of the returned stripe.
+    int             ReadLock()      { return _mapLock.readLock(); }
+    void            ReadUnlock(int stripe) { _mapLock.readUnlock(stripe); }
+    void            WriteLock()     { _mapLock.writeLock(); }
+    bool            TryWriteLock()  { return _mapLock.tryWriteLock(); }
+    void            WriteUnlock()
+                    {
+                        // Any changes made by the writer may have invalidated
+                        // the stages held by the per-thread lookup caches.
+                        _generation.fetch_add(1, std::memory_order_release);
+                        _mapLock.writeUnlock();
+                    }
 
     /// Methods accessible to GusdStageCacheReader.
     /// These require only a shared lock to the stage.
@@ -349,6 +486,16 @@ public:
     SdfLayerRefPtr  FindOrOpenLayer(const UT_StringRef& path,
                                     UT_ErrorSeverity sev=UT_ERROR_ABORT);
 
+    /// Return the root layer shared by all masked stages of \p path.
+    /// The layer is opened on first access.
+    SdfLayerRefPtr  FindOrOpenDonorLayer(const UT_StringRef& path,
+                                         UT_ErrorSeverity sev=UT_ERROR_ABORT);
+
+    /// Hold on to all non-anonymous layers used by the masked \p stage,
+    /// so that they are shared by any masked stages opened later on.
+    void            AdoptDonorLayers(const UT_StringRef& path,
+                                     const UsdStageRefPtr& stage);
+
     UsdStageRefPtr  FindStage(const UT_StringRef& path,
                               const GusdStageOpts& opts,
                               const GusdStageEditPtr& edit) const;
@@ -405,6 +552,29 @@ public:
 
     DEP_MicroNode*  GetStageMicroNode(const UsdStagePtr& stage);
 
+    /// Start tracking memory and access stamps for a newly cached stage.
+    void            RegisterStage(const UsdStageRefPtr& stage);
+
+    /// Update the access stamp of \p stage.
+    void            TouchStage(const UsdStageRefPtr& stage) const;
+
+    /// Advance the access clock. This is done once per cache reader, rather
+    /// than on every lookup, to keep cache hits from contending on a
+    /// shared counter.
+    void            AdvanceAccessClock()
+                    { _accessClock.fetch_add(1, std::memory_order_relaxed); }
+
+    void            SetMemoryBudget(int64 bytes)    { _memoryBudget = bytes; }
+    int64           GetMemoryBudget() const         { return _memoryBudget; }
+    int64           GetMemoryUsage() const          { return _memoryUsage; }
+
+    /// Returns true if there is a budget, and the cache exceeds it.
+    bool            IsOverBudget() const
+                    {
+                        const int64 budget = _memoryBudget;
+                        return budget > 0 && _memoryUsage > budget;
+                    }
+
 
     /// Methods accessible to GusdStageCacheWriter.
     /// These require an exclusive lock to the stage.
@@ -429,6 +599,15 @@ public:
     void            FindStages(const UT_StringSet& paths,
                                UT_Set<UsdStageRefPtr>& stages) const;
 
+    void            GetStageStats(UT_Array<GusdStageCache::StageStats>& stats);
+
+    void            GetMemoryReport(
+                        UT_Array<GusdStageCache::MemoryStats>& stats);
+
+    /// Evict least recently used stages until the cache is within its budget.
+    /// Returns the estimated number of bytes freed.
+    int64           EvictToBudget();
+
     void            InsertStage(UsdStageRefPtr &stage,
                                 const UT_StringRef& path,
                                 const GusdStageOpts& opts,
@@ -464,6 +643,17 @@ protected:
     /// Expand the set of masked prims on a stage.
     void            _ExpandStageMask(UsdStageRefPtr& stage);
 
+    /// Open the root layers of all distinct files referenced by \p ranges
+    /// of the sorted \p primRange in parallel, storing them in \p layers.
+    /// Returns false if a layer fails to open and \p sev is at least
+    /// UT_ERROR_ABORT.
+    template <typename PrimRangeT>
+    bool            _PreloadRootLayers(
+                        const PrimRangeT& primRange,
+                        const UT_Array<std::pair<exint,exint> >& ranges,
+                        UT_Array<SdfLayerRefPtr>& layers,
+                        UT_ErrorSeverity sev=UT_ERROR_ABORT);
+
     /// Get a range of prims from \p stage, using the same range
     /// encoding as LoadPrimRange.
     template <typename PrimRangeFn>
@@ -488,7 +678,7 @@ private:
         static bool equal(const UsdStagePtr& a, const UsdStagePtr& b)
                     { return a == b; }
 
-        static bool hash(const UsdStagePtr& stage)
+        static size_t hash(const UsdStagePtr& stage)
                     { return SYShash(stage); }
     };
 
@@ -498,9 +688,99 @@ private:
                              std::shared_ptr<_StageChangeMicroNode>,
                              _StageHashCmp>;
 
+    struct _StageUsage
+    {
+        int64                       memorySize = 0;
+        /// False until memorySize has been estimated. Estimating is skipped
+        /// while there is no budget, and done when stats are next computed.
+        bool                        estimated = false;
+        mutable std::atomic<exint>  lastAccess {0};
+    };
+
+    using _StageUsageMap =
+        UT_ConcurrentHashMap<UsdStagePtr,
+                             UT_UniquePtr<_StageUsage>,
+                             _StageHashCmp>;
+
+    /// Compute the stats of all stages on the cache.
+    /// Expired entries of the usage map are pruned along the way.
+    void            _ComputeStageStats(
+                        UT_Array<GusdStageCache::StageStats>& stats);
+
+    /// Returns true if a micro node of \p stage has dependents.
+    bool            _HasMicroNodeDependents(const UsdStagePtr& stage) const;
+
+    static void     _TouchUsage(const _StageUsage& usage, exint stamp)
+                    {
+                        // Avoid writing to the shared entry unless the
+                        // stamp has changed.
+                        if(usage.lastAccess.load(
+                               std::memory_order_relaxed) != stamp) {
+                            usage.lastAccess.store(
+                                stamp, std::memory_order_relaxed);
+                        }
+                    }
+
+    /// Small per-thread cache of recent hits on the unmasked stage map.
+    /// Cache hits on this table don't need to touch any state that is shared
+    /// with other threads, other than the stage's reference count.
+    /// Entries only hold raw pointers to the stages, as reference counts are
+    /// used to determine which stages may be evicted. This is safe because
+    /// stages can only be removed from the cache while the exclusive lock is
+    /// held, and releasing the exclusive lock bumps the generation, which
+    /// invalidates all of the per-thread entries.
+    struct _ThreadStageCache
+    {
+        static constexpr int theNumEntries = 8;
+
+        struct Entry
+        {
+            _StageKey           key;
+            UsdStage*           stage = nullptr;
+            const _StageUsage*  usage = nullptr;
+        };
+
+        void    Reset(exint newGeneration)
+                {
+                    for(auto& entry : entries)
+                        entry = Entry();
+                    generation = newGeneration;
+                    next = 0;
+                }
+
+        Entry   entries[theNumEntries];
+        exint   generation = -1;
+        int     next = 0;
+    };
+
+    using _ThreadStageCacheTLS = UT_ThreadSpecificValue<_ThreadStageCache>;
+
+    /// Layers shared across all masked stages of a file.
+    /// Masked stages only differ in their population masks, so all of them
+    /// can be built from the same root layer and layer stack. Holding the
+    /// layers here means that they're only opened once per file, even if
+    /// many masked stages are opened for it.
+    struct _LayerDonor
+    {
+        UT_Lock                 lock;
+        SdfLayerRefPtr          rootLayer;
+        UT_Set<SdfLayerRefPtr>  layers;
+    };
+
+    using _LayerDonorMap =
+        UT_ConcurrentHashMap<UT_StringHolder,
+                             UT_UniquePtr<_LayerDonor>,
+                             _StringHashCmp>;
+
     /// Mutex around the concurrent maps.
     /// An exclusive lock must be acquired when iterating over the maps.
-    UT_RWLock   _mapLock;
+    _StripedRWLock  _mapLock;
+
+    /// Generation of the maps, incremented whenever a writer releases the
+    /// exclusive lock.
+    std::atomic<exint> _generation;
+
+    mutable _ThreadStageCacheTLS _threadStageCache;
 
     /// Data cache mutex.
     /// Must be acquired when accessing data caches in any way.  
@@ -513,11 +793,78 @@ private:
 
     /// Cache of micro nodes for layers (created on request only).
     _MicroNodeMap _microNodeMap;
+
+    /// Memory and access tracking for all cached stages.
+    _StageUsageMap _usageMap;
+
+    /// Shared layers for masked stages, by file path.
+    _LayerDonorMap _donorMap;
     
     UT_Array<GusdUSD_DataCache*> _dataCaches;
+
+    std::atomic<exint> _accessClock;
+    std::atomic<int64> _memoryUsage;
+    std::atomic<int64> _memoryBudget;
+};
+
+
+namespace {
+
+
+/// Estimate the memory held by a stage.
+/// There is no way of querying the memory actually held by USD's data
+/// structures, so this approximates it from the size of the layers on disk,
+/// and a nominal amount per composed prim.
+int64
+_EstimateStageMemory(const UsdStageRefPtr& stage)
+{
+    // Very rough estimate of a composed prim, including its prim index.
+    static constexpr int64 thePrimSize = 1024;
+
+    int64 size = 0;
+    for(const SdfLayerHandle& layer : stage->GetUsedLayers()) {
+        if(layer && !layer->IsAnonymous()) {
+            const int64_t fileSize =
+                ArchGetFileLength(layer->GetRealPath().c_str());
+            if(fileSize > 0)
+                size += fileSize;
+        }
+    }
+    for(const UsdPrim& prim : stage->Traverse(UsdPrimAllPrimsPredicate)) {
+        TF_UNUSED(prim);
+        size += thePrimSize;
+    }
+    return size;
+}
+
+
+/// Reporters adding other caches to memory reports.
+struct _MemoryReporters
+{
+    static _MemoryReporters&    Get()
+                                {
+                                    static _MemoryReporters theReporters;
+                                    return theReporters;
+                                }
+
+    UT_Lock                                     lock;
+    UT_Array<GusdStageCache::MemoryReporter>    reporters;
 };
 
 
+} // namespace
+
+
+GusdStageCache::_Impl::_Impl()
+    : _generation(0)
+    , _accessClock(0)
+    , _memoryUsage(0)
+    , _memoryBudget(TfGetEnvSetting(GUSD_STAGECACHE_MEMORY_BUDGET) *
+                    int64(1024*1024))
+{
+}
+
+
 GusdStageCache::_Impl::~_Impl()
 {
     // Clear entries, but don't propagate dirty states, as we
@@ -571,8 +918,12 @@ GusdStageCache::_Impl::OpenNewStage(const UT_StringRef& path,
         return TfNullPtr;
     }
 
+    const bool useDonorLayers =
+        mask && TfGetEnvSetting(GUSD_STAGEMASK_SHARE_LAYERS);
+
     // The root layer is shared, and not modified.
-    if(SdfLayerRefPtr rootLayer = FindOrOpenLayer(path, sev)) {
+    if(SdfLayerRefPtr rootLayer = useDonorLayers
+       ? FindOrOpenDonorLayer(path, sev) : FindOrOpenLayer(path, sev)) {
 
         // Need a unique session layer on which to apply any edits.
         SdfLayerRefPtr sessionLayer;
@@ -603,6 +954,9 @@ GusdStageCache::_Impl::OpenNewStage(const UT_StringRef& path,
 
             if(mask)
                 _ExpandStageMask(stage);
+            if(useDonorLayers)
+                AdoptDonorLayers(path, stage);
+            RegisterStage(stage);
             return stage;
         } else {
             GUSD_GENERIC_ERR(sev).Msg(
@@ -809,6 +1163,61 @@ GusdStageCache::_Impl::FindOrOpenLayer(const UT_StringRef& path,
 }
 
 
+SdfLayerRefPtr
+GusdStageCache::_Impl::FindOrOpenDonorLayer(const UT_StringRef& path,
+                                            UT_ErrorSeverity sev)
+{
+    _LayerDonor* donor = nullptr;
+    {
+        _LayerDonorMap::const_accessor a;
+        if(_donorMap.find(a, UTmakeUnsafeRef(path)))
+            donor = a->second.get();
+    }
+    if(!donor) {
+        _LayerDonorMap::accessor a;
+        if(_donorMap.insert(a, UT_StringHolder(path)))
+            a->second.reset(new _LayerDonor);
+        donor = a->second.get();
+    }
+    UT_ASSERT_P(donor);
+
+    // Hold the donor's lock while opening, so that concurrent opens of
+    // masked stages of the same file wait on a single layer open.
+    UT_AutoLock lock(donor->lock);
+    if(!donor->rootLayer) {
+        donor->rootLayer = FindOrOpenLayer(path, sev);
+        if(donor->rootLayer) {
+            TF_DEBUG(GUSD_STAGECACHE).Msg(
+                "[GusdStageCache::FindOrOpenDonorLayer] Sharing layer %s "
+                "across masked stages of @%s@\n",
+                donor->rootLayer->GetIdentifier().c_str(), path.c_str());
+        }
+    }
+    return donor->rootLayer;
+}
+
+
+void
+GusdStageCache::_Impl::AdoptDonorLayers(const UT_StringRef& path,
+                                        const UsdStageRefPtr& stage)
+{
+    _LayerDonorMap::const_accessor a;
+    if(!_donorMap.find(a, UTmakeUnsafeRef(path)))
+        return;
+
+    // Gather the layers before locking to keep the locked scope short.
+    const SdfLayerHandleVector usedLayers = stage->GetUsedLayers();
+
+    _LayerDonor& donor = *a->second;
+    UT_AutoLock lock(donor.lock);
+    for(const SdfLayerHandle& layer : usedLayers) {
+        // Session layers are anonymous, and unique to each stage.
+        if(layer && !layer->IsAnonymous())
+            donor.layers.insert(SdfLayerRefPtr(layer));
+    }
+}
+
+
 UsdStageRefPtr
 GusdStageCache::_Impl::FindStage(const UT_StringRef& path,
                                  const GusdStageOpts& opts,
@@ -817,9 +1226,47 @@ GusdStageCache::_Impl::FindStage(const UT_StringRef& path,
     // XXX: empty paths should be caught earlier.
     UT_ASSERT_P(path);
 
+    // Note that this key doesn't own its path, so it must not be stored.
+    const _StageKey key(UTmakeUnsafeRef(path), opts, edit);
+
+    const exint stamp = _accessClock.load(std::memory_order_relaxed);
+
+    _ThreadStageCache& threadCache = _threadStageCache.get();
+    const exint generation = _generation.load(std::memory_order_acquire);
+    if(threadCache.generation == generation) {
+        for(const auto& entry : threadCache.entries) {
+            if(entry.stage && _StageKeyHashCmp::equal(entry.key, key)) {
+                if(entry.usage)
+                    _TouchUsage(*entry.usage, stamp);
+                return UsdStageRefPtr(entry.stage);
+            }
+        }
+    } else {
+        threadCache.Reset(generation);
+    }
+
     _StageMap::const_accessor a;
-    if(_stageMap.find(a, _StageKey(UTmakeUnsafeRef(path), opts, edit)))
+    if(_stageMap.find(a, key)) {
+        const _StageUsage* usage = nullptr;
+        {
+            _StageUsageMap::const_accessor usageAcc;
+            if(_usageMap.find(usageAcc, UsdStagePtr(a->second))) {
+                usage = usageAcc->second.get();
+                _TouchUsage(*usage, stamp);
+            }
+        }
+
+        // Remember the hit for future lookups on this thread.
+        // Copy the key from the map, since that owns its path.
+        auto& entry = threadCache.entries[threadCache.next];
+        threadCache.next =
+            (threadCache.next + 1) % _ThreadStageCache::theNumEntries;
+        entry.key = a->first;
+        entry.stage = get_pointer(a->second);
+        entry.usage = usage;
+
         return a->second;
+    }
 
     return TfNullPtr;
 }
@@ -1060,6 +1507,22 @@ GusdStageCache::_Impl::GetDefaultPrimPath(const UT_StringRef& path,
     ArResolverContext resolverContext = ArGetResolver().GetCurrentContext();
     ArResolverContextBinder binder(resolverContext);
 
+    if (TfGetEnvSetting(GUSD_STAGEMASK_SHARE_LAYERS) &&
+        !path.startsWith("op:")) {
+        // The defaultPrim is only needed when opening masked stages, which
+        // will be built from the shared donor layer. Open that right away,
+        // rather than parsing the layer twice.
+        if (const SdfLayerRefPtr layer = FindOrOpenDonorLayer(path, sev)) {
+            const TfToken name = layer->GetDefaultPrim();
+            if (SdfPath::IsValidIdentifier(name)) {
+                return SdfPath::AbsoluteRootPath().AppendChild(name);
+            }
+            GUSD_GENERIC_ERR(sev).Msg(
+                "No valid defaultPrim defined in layer @%s@", path.c_str());
+        }
+        return SdfPath();
+    }
+
     // Open layer with metadataOnly to reduce parsing costs.
     // TODO: The cache will likely need to do a full layer parse with
     // SdfLayer::FindOrOpen() shortly after this point. Would be better to find
@@ -1227,35 +1690,120 @@ GusdStageCache::_Impl::LoadPrims(
 
     GusdErrorTransport errTransport;
 
-    UTparallelFor(
-        UT_BlockedRange<size_t>(0, ranges.size()),
-        [&](const UT_BlockedRange<size_t>& r)
+    const auto loadRanges = [&](const UT_BlockedRange<exint>& r)
+    {
+        GusdAutoErrorTransport autoErrTransport(errTransport);
+
+        auto* boss = UTgetInterrupt();
+
+        for(exint i = r.begin(); i < r.end(); ++i) {
+            if(ARCH_UNLIKELY(boss->opInterrupt() || workerInterrupt)) {
+                return;
+            }
+
+            const auto& range = ranges(i);
+
+            // Can get the file/edit from the first key in the range.
+            const auto& key = primRange.keys(range.first);
+
+            if(!LoadPrimRange(primRange, range.first, range.second,
+                              key.path, opts, key.edit,
+                              primPaths, prims, sev)) {
+                // Interrupt the other worker threads.
+                workerInterrupt = true;
+                break;
+            }
+        }
+    };
+
+    if(!TfGetEnvSetting(GUSD_STAGECACHE_BATCHED_OPEN)) {
+        UTparallelFor(UT_BlockedRange<exint>(0, ranges.size()), loadRanges);
+        return !task.wasInterrupted() && !workerInterrupt;
+    }
+
+    // Batched open: Ranges that reference the same file with different
+    // edits all compose on top of the same root layer. Open each distinct
+    // root layer exactly once, in parallel, before any stages are composed,
+    // so that stage opening doesn't serialize on the layer registry.
+    // The opened layers must be held for the duration of the load, since
+    // the layer registry only holds weak references.
+    UT_Array<SdfLayerRefPtr> rootLayers;
+    if(!_PreloadRootLayers(primRange, ranges, rootLayers, sev)) {
+        return false;
+    }
+
+    // Stage opens are both expensive and very uneven in cost, so hand
+    // out each distinct stage to its own task rather than splitting the
+    // ranges into blocks, which may serialize several opens on one thread.
+    UTparallelForEachNumber(ranges.size(), loadRanges);
+
+    return !task.wasInterrupted() && !workerInterrupt;
+}
+
+
+template <typename PrimRangeT>
+bool
+GusdStageCache::_Impl::_PreloadRootLayers(
+    const PrimRangeT& primRange,
+    const UT_Array<std::pair<exint,exint> >& ranges,
+    UT_Array<SdfLayerRefPtr>& layers,
+    UT_ErrorSeverity sev)
+{
+    // Ranges are sorted by path, so the distinct paths are contiguous.
+    UT_Array<UT_StringHolder> layerPaths;
+    for(const auto& range : ranges) {
+        const UT_StringHolder& path = primRange.keys(range.first).path;
+
+        // LOP stages are produced through the resolver callback,
+        // and don't have root layers that we can open directly.
+        if(path.startsWith("op:"))
+            continue;
+
+        if(layerPaths.isEmpty() || layerPaths.last() != path)
+            layerPaths.append(path);
+    }
+    if(layerPaths.size() < 2) {
+        // Nothing to gain from opening the layer ahead of time.
+        return true;
+    }
+
+    TF_DEBUG(GUSD_STAGECACHE).Msg(
+        "[GusdStageCache::LoadPrims] Opening %zd root layers for %zd "
+        "stages\n", size_t(layerPaths.size()), size_t(ranges.size()));
+
+    layers.setSize(layerPaths.size());
+
+    // Resolution needs to happen in the context that the stages
+    // will later be opened in.
+    const ArResolverContext resolverContext =
+        ArGetResolver().GetCurrentContext();
+
+    std::atomic_bool workerInterrupt(false);
+
+    GusdErrorTransport errTransport;
+
+    UTparallelForEachNumber(
+        layerPaths.size(),
+        [&](const UT_BlockedRange<exint>& r)
         {
             GusdAutoErrorTransport autoErrTransport(errTransport);
+            ArResolverContextBinder binder(resolverContext);
 
             auto* boss = UTgetInterrupt();
-            
-            for(size_t i = r.begin(); i < r.end(); ++i) {
+
+            for(exint i = r.begin(); i < r.end(); ++i) {
                 if(ARCH_UNLIKELY(boss->opInterrupt() || workerInterrupt)) {
                     return;
                 }
-
-                const auto& range = ranges(i);
-                
-                // Can get the file/edit from the first key in the range.
-                const auto& key = primRange.keys(range.first);
-
-                if(!LoadPrimRange(primRange, range.first, range.second,
-                                  key.path, opts, key.edit,
-                                  primPaths, prims, sev)) {
-                    // Interrupt the other worker threads.
+                layers(i) = FindOrOpenLayer(layerPaths(i), sev);
+                if(!layers(i) && sev >= UT_ERROR_ABORT) {
                     workerInterrupt = true;
                     break;
                 }
             }
         });
-    
-    return !task.wasInterrupted() && !workerInterrupt;
+
+    return !workerInterrupt;
 }
 
 
@@ -1341,6 +1889,11 @@ GusdStageCache::_Impl::Clear(bool propagateDirty)
         }
     }
     _microNodeMap.clear();
+
+    _usageMap.clear();
+    _memoryUsage = 0;
+
+    _donorMap.clear();
 }
 
 
@@ -1372,6 +1925,14 @@ GusdStageCache::_Impl::Clear(const UT_StringSet& paths, bool propagateDirty)
     for(const auto& key : keysToRemove)
         _maskedCacheMap.erase(key);
 
+    UT_Array<UT_StringHolder> donorsToRemove;
+    for(const auto& pair : _donorMap) {
+        if(paths.contains(pair.first))
+            donorsToRemove.append(pair.first);
+    }
+    for(const auto& path : donorsToRemove)
+        _donorMap.erase(path);
+
     // Update and clear micro nodes.
     for(const UsdStageRefPtr& stage : stagesBeingRemoved) {
 
@@ -1382,6 +1943,12 @@ GusdStageCache::_Impl::Clear(const UT_StringSet& paths, bool propagateDirty)
             }
         }
         _microNodeMap.erase(stage);
+
+        _StageUsageMap::accessor a;
+        if(_usageMap.find(a, stage)) {
+            _memoryUsage -= a->second->memorySize;
+            _usageMap.erase(a);
+        }
     }
 
 
@@ -1428,7 +1995,232 @@ GusdStageCache::_Impl::InsertStage(UsdStageRefPtr &stage,
     _StageMap::accessor a;
     if(stage && _stageMap.insert(a, _StageKey(path, opts, edit))) {
         a->second = stage;
+        RegisterStage(stage);
+    }
+}
+
+
+void
+GusdStageCache::_Impl::RegisterStage(const UsdStageRefPtr& stage)
+{
+    UT_ASSERT_P(stage);
+
+    _StageUsageMap::accessor a;
+    if(_usageMap.insert(a, UsdStagePtr(stage))) {
+        a->second.reset(new _StageUsage);
+        a->second->lastAccess = _accessClock.load(std::memory_order_relaxed);
+
+        // Estimating traverses the whole stage, so don't do it when there
+        // is no budget to enforce.
+        if(_memoryBudget > 0) {
+            a->second->memorySize = _EstimateStageMemory(stage);
+            a->second->estimated = true;
+            _memoryUsage += a->second->memorySize;
+        }
+    }
+}
+
+
+void
+GusdStageCache::_Impl::TouchStage(const UsdStageRefPtr& stage) const
+{
+    _StageUsageMap::const_accessor a;
+    if(_usageMap.find(a, UsdStagePtr(stage)))
+        _TouchUsage(*a->second, _accessClock.load(std::memory_order_relaxed));
+}
+
+
+bool
+GusdStageCache::_Impl::_HasMicroNodeDependents(const UsdStagePtr& stage) const
+{
+    _MicroNodeMap::const_accessor a;
+    if(_microNodeMap.find(a, stage)) {
+        DEP_MicroNodeList outputs;
+        a->second->getOutputs(outputs);
+        return outputs.entries() > 0;
+    }
+    return false;
+}
+
+
+void
+GusdStageCache::_Impl::_ComputeStageStats(
+    UT_Array<GusdStageCache::StageStats>& stats)
+{
+    // XXX: Caller should have an exclusive map lock!
+
+    // Count the references that the cache itself holds to each stage.
+    // Any additional references are held by clients of the cache.
+    UT_Map<const UsdStage*,exint> cacheRefs;
+    for(const auto& pair : _stageMap)
+        ++cacheRefs[get_pointer(pair.second)];
+    for(const auto& pair : _maskedCacheMap)
+        pair.second->CountStageRefs(cacheRefs);
+
+    UT_Array<UsdStagePtr> expired;
+    for(const auto& pair : _usageMap) {
+        const UsdStagePtr& stage = pair.first;
+        if(!stage) {
+            expired.append(stage);
+            _memoryUsage -= pair.second->memorySize;
+            continue;
+        }
+
+        // Estimate any stages registered while there was no budget.
+        if(!pair.second->estimated) {
+            pair.second->memorySize = _EstimateStageMemory(stage);
+            pair.second->estimated = true;
+            _memoryUsage += pair.second->memorySize;
+        }
+
+        // Note that the reference is counted before it's held by the stats.
+        const auto it = cacheRefs.find(get_pointer(stage));
+        const exint numCacheRefs = (it != cacheRefs.end()) ? it->second : 0;
+
+        GusdStageCache::StageStats& entry = stats(stats.append());
+        entry.evictable = (numCacheRefs > 0 &&
+                           stage->GetCurrentCount() == numCacheRefs &&
+                           !_HasMicroNodeDependents(stage));
+        entry.stage = UsdStageRefPtr(get_pointer(stage));
+        entry.memorySize = pair.second->memorySize;
+        entry.lastAccess = pair.second->lastAccess;
+    }
+    for(const auto& stage : expired)
+        _usageMap.erase(stage);
+}
+
+
+void
+GusdStageCache::_Impl::GetStageStats(
+    UT_Array<GusdStageCache::StageStats>& stats)
+{
+    // XXX: Caller should have an exclusive map lock!
+    _ComputeStageStats(stats);
+}
+
+
+void
+GusdStageCache::_Impl::GetMemoryReport(
+    UT_Array<GusdStageCache::MemoryStats>& stats)
+{
+    // XXX: Caller should have an exclusive map lock!
+
+    UT_Array<GusdStageCache::StageStats> stageStats;
+    _ComputeStageStats(stageStats);
+
+    stats.setCapacityIfNeeded(stats.size() + stageStats.size());
+    for(const auto& stageEntry : stageStats) {
+        GusdStageCache::MemoryStats& entry = stats(stats.append());
+        entry.category = "stage";
+        entry.name = stageEntry.stage->GetRootLayer()->GetIdentifier();
+        entry.memorySize = stageEntry.memorySize;
+        entry.entries = 1;
+    }
+
+    {
+        UT_AutoLock lock(_dataCacheLock);
+        for(const auto* cache : _dataCaches) {
+            GusdStageCache::MemoryStats& entry = stats(stats.append());
+            entry.category = "dataCache";
+            entry.name = cache->GetName();
+            entry.memorySize = cache->GetMemoryUsage();
+            entry.entries = 1;
+        }
+    }
+
+    // Copy the reporters, so that they aren't run while holding the lock.
+    UT_Array<GusdStageCache::MemoryReporter> reporters;
+    {
+        _MemoryReporters& registry = _MemoryReporters::Get();
+        UT_AutoLock lock(registry.lock);
+        reporters = registry.reporters;
+    }
+    for(const auto& reporter : reporters)
+        reporter(stats);
+}
+
+
+int64
+GusdStageCache::_Impl::EvictToBudget()
+{
+    // XXX: Caller should have an exclusive map lock!
+
+    UT_Array<GusdStageCache::StageStats> stats;
+    _ComputeStageStats(stats);
+
+    const int64 budget = _memoryBudget;
+    if(budget <= 0 || _memoryUsage <= budget)
+        return 0;
+
+    // Evict the least recently used stages first.
+    stats.stdsort([](const GusdStageCache::StageStats& a,
+                     const GusdStageCache::StageStats& b)
+                  { return a.lastAccess < b.lastAccess; });
+
+    UT_Set<const UsdStage*> stagesToEvict;
+    UT_StringSet pathsToClear;
+    int64 freed = 0;
+    for(const auto& entry : stats) {
+        if(_memoryUsage - freed <= budget)
+            break;
+        if(!entry.evictable)
+            continue;
+
+        TF_DEBUG(GUSD_STAGECACHE).Msg(
+            "[GusdStageCache::EvictToBudget] Evicting %s (%lld bytes)\n",
+            UsdDescribe(entry.stage).c_str(), (long long)entry.memorySize);
+
+        stagesToEvict.insert(get_pointer(entry.stage));
+        pathsToClear.insert(entry.stage->GetRootLayer()->GetIdentifier());
+        freed += entry.memorySize;
+    }
+    if(stagesToEvict.empty())
+        return 0;
+
+    UT_Array<_StageKey> keysToRemove;
+    for(const auto& pair : _stageMap) {
+        if(stagesToEvict.contains(get_pointer(pair.second)))
+            keysToRemove.append(pair.first);
+    }
+    for(const auto& key : keysToRemove)
+        _stageMap.erase(key);
+
+    keysToRemove.clear();
+    for(auto& pair : _maskedCacheMap) {
+        pair.second->RemoveStages(stagesToEvict);
+        if(pair.second->IsEmpty()) {
+            keysToRemove.append(pair.first);
+            delete pair.second;
+        }
+    }
+    for(const auto& key : keysToRemove) {
+        _maskedCacheMap.erase(key);
+        // Release the shared layers along with the last masked stages.
+        // Any remaining masked stages for other edits of the same file
+        // still hold their own layers.
+        _donorMap.erase(key.GetPath());
+    }
+
+    for(auto& entry : stats) {
+        if(stagesToEvict.contains(get_pointer(entry.stage))) {
+            const UsdStagePtr stage(entry.stage);
+            // Micro nodes of evicted stages have no dependents,
+            // so there is no dirty state to propagate.
+            _microNodeMap.erase(stage);
+            _usageMap.erase(stage);
+        }
+    }
+    _memoryUsage -= freed;
+
+    // Data caches may still hold prims of the evicted stages.
+    {
+        UT_AutoLock lock(_dataCacheLock);
+        for(auto* cache : _dataCaches) {
+            UT_ASSERT_P(cache);
+            cache->Clear(pathsToClear);
+        }
     }
+    return freed;
 }
 
 
@@ -1438,8 +2230,10 @@ GusdStageCache::_MaskedStageCache::FindStage(const SdfPath& primPath)
     UT_ASSERT_P(_IsValidPrimPath(primPath));
 
     _StageMap::const_accessor ancestorAcc; 
-    if(_map.find(ancestorAcc, primPath))
+    if(_map.find(ancestorAcc, primPath)) {
+        _stageCache.TouchStage(ancestorAcc->second);
         return ancestorAcc->second;
+    }
 
     // The cache holds a map of primPath->stage. When a prim is loaded
     // with masking, all of its descendant prims are fully loaded.
@@ -1454,6 +2248,8 @@ GusdStageCache::_MaskedStageCache::FindStage(const SdfPath& primPath)
             ++distanceToMatchingAncestor) {
 
             if(_map.find(ancestorAcc, ancestorPath)) {
+                _stageCache.TouchStage(ancestorAcc->second);
+
                 // Insert an entry on the cache for this prim if we traversed
                 // further than we would like to find a loaded prim,
                 // in order to speed up future lookups.
@@ -1700,6 +2496,20 @@ GusdStageCache::_MaskedStageCache::LoadPrimRange(
 }
 
 
+void
+GusdStageCache::_MaskedStageCache::RemoveStages(
+    const UT_Set<const UsdStage*>& stages)
+{
+    UT_Array<SdfPath> pathsToRemove;
+    for(const auto& pair : _map) {
+        if(stages.contains(get_pointer(pair.second)))
+            pathsToRemove.append(pair.first);
+    }
+    for(const auto& path : pathsToRemove)
+        _map.erase(path);
+}
+
+
 GusdStageCache&
 GusdStageCache::GetInstance()
 {
@@ -1831,8 +2641,45 @@ GusdStageCache::RemoveDataCache(GusdUSD_DataCache& cache)
 }
 
 
+void
+GusdStageCache::SetMemoryBudget(int64 bytes)
+{
+    _impl->SetMemoryBudget(bytes);
+}
+
+
+int64
+GusdStageCache::GetMemoryBudget() const
+{
+    return _impl->GetMemoryBudget();
+}
+
+
+int64
+GusdStageCache::GetMemoryUsage() const
+{
+    return _impl->GetMemoryUsage();
+}
+
+
+void
+GusdStageCache::AddMemoryReporter(const MemoryReporter& reporter)
+{
+    _MemoryReporters& registry = _MemoryReporters::Get();
+    UT_AutoLock lock(registry.lock);
+    registry.reporters.append(reporter);
+}
+
+
+int64
+GusdStageCache::EstimateStageMemory(const UsdStageRefPtr& stage)
+{
+    return stage ? _EstimateStageMemory(stage) : 0;
+}
+
+
 GusdStageCacheReader::GusdStageCacheReader(GusdStageCache& cache, bool writer)
-    : _cache(cache), _writer(writer)
+    : _cache(cache), _writer(writer), _lockStripe(-1)
 {
     // Tell the stage cache reader tracker that we are constructing a new
     // stage cache reader (or writer).
@@ -1840,18 +2687,31 @@ GusdStageCacheReader::GusdStageCacheReader(GusdStageCache& cache, bool writer)
         theStageCacheReaderTracker(true);
 
     if(writer)
-        _cache._impl->GetMapLock().writeLock();
+        _cache._impl->WriteLock();
     else
-        _cache._impl->GetMapLock().readLock();
+        _lockStripe = _cache._impl->ReadLock();
+
+    _cache._impl->AdvanceAccessClock();
 }
 
 
 GusdStageCacheReader::~GusdStageCacheReader()
 {
     if(_writer)
-        _cache._impl->GetMapLock().writeUnlock();
+        _cache._impl->WriteUnlock();
     else
-        _cache._impl->GetMapLock().readUnlock();
+        _cache._impl->ReadUnlock(_lockStripe);
+
+    // Opportunistically enforce the memory budget. This is restricted to
+    // the main thread, and only happens if no other readers are active,
+    // so that cooks never block on eviction.
+    if(!_writer && _cache._impl->IsOverBudget() &&
+       UT_Thread::isMainThread() &&
+       _cache._impl->TryWriteLock()) {
+
+        _cache._impl->EvictToBudget();
+        _cache._impl->WriteUnlock();
+    }
 
     // Tell the stage cache reader tracker that we are destroying a
     // stage cache reader (or writer).
@@ -1875,6 +2735,8 @@ GusdStageCacheReader::FindOrOpen(const UT_StringRef& path,
                                  const GusdStageEditPtr& edit,
                                  UT_ErrorSeverity sev)
 {
+    TRACE_FUNCTION();
+
     return path ? _cache._impl->FindOrOpenStage(
         path, opts, edit, sev) : TfNullPtr;
 }
@@ -1956,8 +2818,7 @@ GusdStageCacheReader::GetPrimWithVariants(const UT_StringRef& path,
 {
     GusdStageEditPtr edit;
     if(variants.ContainsPrimVariantSelection()) {
-        edit.reset(new GusdStageEdit);
-        edit->GetVariants().append(variants);
+        edit = GusdStageEdit::GetVariantsEdit(variants);
     }
     return GetPrim(path, primPath, edit, opts, sev);
 }
@@ -2036,4 +2897,27 @@ GusdStageCacheWriter::ReloadStages(const UT_StringSet& paths)
     GusdStageCache::ReloadStages(stagePtrs);
 }
 
+
+void
+GusdStageCacheWriter::GetStageStats(
+    UT_Array<GusdStageCache::StageStats>& stats)
+{
+    _cache._impl->GetStageStats(stats);
+}
+
+
+void
+GusdStageCacheWriter::GetMemoryReport(
+    UT_Array<GusdStageCache::MemoryStats>& stats)
+{
+    _cache._impl->GetMemoryReport(stats);
+}
+
+
+int64
+GusdStageCacheWriter::EvictToBudget()
+{
+    return _cache._impl->EvictToBudget();
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
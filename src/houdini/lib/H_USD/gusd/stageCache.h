@@ -27,6 +27,7 @@
 #include <UT/UT_Array.h>
 #include <UT/UT_Error.h>
 #include <UT/UT_Set.h>
+#include <UT/UT_StringHolder.h>
 
 #include "gusd/defaultArray.h"
 #include "gusd/stageEdit.h"
@@ -37,9 +38,10 @@
 #include "pxr/usd/sdf/layer.h"
 #include "pxr/usd/usd/stage.h"
 
+#include <functional>
+
 class OP_Node;
 class DEP_MicroNode;
-class UT_StringHolder;
 class UT_StringSet;
 class UT_StringRef;
 
@@ -134,6 +136,71 @@ public:
     /// Mark a set of layers for reload on the event queue.
     static void ReloadLayers(const UT_Set<SdfLayerHandle>& layers);
 
+    /// \section GusdStageCache_Budget Memory Budget
+    ///
+    /// The cache may be given a memory budget, in bytes. When the estimated
+    /// memory of all cached stages exceeds the budget, the least recently
+    /// used stages are evicted, until the cache fits within the budget again.
+    /// Only stages that are not referenced outside of the cache, and that
+    /// have no micro node with dependents, are considered for eviction.
+    /// Eviction happens either explicitly, through
+    /// GusdStageCacheWriter::EvictToBudget(), or opportunistically when a
+    /// cache reader on the main thread goes out of scope while no other
+    /// readers are active.
+    /// A budget of zero (the default, unless GUSD_STAGECACHE_MEMORY_BUDGET
+    /// is set) disables eviction.
+
+    /// Per-stage memory statistics.
+    struct StageStats
+    {
+        UsdStageRefPtr  stage;
+        /// Estimated memory held by the stage, in bytes.
+        int64           memorySize = 0;
+        /// Access stamp of the last cache lookup returning this stage.
+        /// Larger stamps are more recent.
+        exint           lastAccess = 0;
+        /// Whether or not the stage could be evicted from the cache.
+        bool            evictable = false;
+    };
+
+    void    SetMemoryBudget(int64 bytes);
+    int64   GetMemoryBudget() const;
+
+    /// Returns the estimated memory held by all stages on the cache.
+    int64   GetMemoryUsage() const;
+
+    /// \section GusdStageCache_MemoryReport Memory Report
+    ///
+    /// A memory report breaks down the memory held on behalf of USD data:
+    /// each stage on the cache (category "stage"), each auxiliary data
+    /// cache (category "dataCache"), and whatever any registered memory
+    /// reporters add. Reporters let libraries built on top of gusd include
+    /// their own caches, such as geometry held for LOP stages.
+    /// See GusdStageCacheWriter::GetMemoryReport().
+
+    /// One entry of a memory report.
+    struct MemoryStats
+    {
+        UT_StringHolder category;
+        UT_StringHolder name;
+        /// Estimated memory held, in bytes.
+        int64           memorySize = 0;
+        /// Number of items holding the memory.
+        exint           entries = 0;
+    };
+
+    using MemoryReporter = std::function<void(UT_Array<MemoryStats>&)>;
+
+    /// Register a function that appends entries to every memory report.
+    /// Reporters are never removed, so they must stay valid for the
+    /// lifetime of the process.
+    static void AddMemoryReporter(const MemoryReporter& reporter);
+
+    /// Returns the same estimate of the memory held by \p stage that is
+    /// used for the stages on the cache, for reporters to describe stages
+    /// that the cache doesn't hold.
+    static int64 EstimateStageMemory(const UsdStageRefPtr& stage);
+
 
 private:
     class _MaskedStageCache;
@@ -327,6 +394,7 @@ protected:
 protected:
     GusdStageCache& _cache;
     const bool      _writer;
+    int             _lockStripe;
 };
 
 
@@ -379,6 +447,19 @@ public:
 
     /// Reload all stages matching the given paths.
     void    ReloadStages(const UT_StringSet& paths);
+
+    /// Get memory statistics for all stages on the cache.
+    void    GetStageStats(UT_Array<GusdStageCache::StageStats>& stats);
+
+    /// Get a breakdown of the memory held by the stages and data caches
+    /// of the cache, and by any registered memory reporters
+    /// (see \ref GusdStageCache_MemoryReport).
+    void    GetMemoryReport(UT_Array<GusdStageCache::MemoryStats>& stats);
+
+    /// Evict the least recently used unreferenced stages until the cache
+    /// fits within its memory budget (see \ref GusdStageCache_Budget).
+    /// Returns the estimated number of bytes freed.
+    int64   EvictToBudget();
 };
 
 
@@ -26,11 +26,39 @@
 #include "gusd/USD_Utils.h"
 
 #include <SYS/SYS_Hash.h>
+#include <UT/UT_ConcurrentHashMap.h>
 
 
 PXR_NAMESPACE_OPEN_SCOPE
 
 
+namespace {
+
+struct _SdfPathHashCmp
+{
+    static size_t   hash(const SdfPath& path)
+                    { return SdfPath::Hash()(path); }
+    static bool     equal(const SdfPath& a, const SdfPath& b)
+                    { return a == b; }
+};
+
+using _InternedEditMap =
+    UT_ConcurrentHashMap<SdfPath,GusdStageEditPtr,_SdfPathHashCmp>;
+
+/// Interned edits are never released, so stop interning if the scene has an
+/// unusually large number of distinct variant selections.
+const size_t _MAX_INTERNED_EDITS = 1 << 16;
+
+_InternedEditMap&
+_GetInternedEdits()
+{
+    static _InternedEditMap theEdits;
+    return theEdits;
+}
+
+} /*namespace*/
+
+
 bool
 GusdStageEdit::Apply(const SdfLayerHandle& layer,
                           UT_ErrorSeverity sev) const
@@ -69,6 +97,9 @@ GusdStageEdit::GetHash() const
 bool
 GusdStageEdit::operator==(const GusdStageEdit& o) const
 {
+    // Interned edits are usually compared against themselves.
+    if(this == &o)
+        return true;
     return _variants == o._variants && _layersToMute == o._layersToMute;
 }
 
@@ -83,10 +114,44 @@ GusdStageEdit::GetPrimPathAndEditFromVariantsPath(
     GusdUSD_Utils::ExtractPrimPathAndVariants(pathWithVariants,
                                               primPath, variants);
     if(!variants.IsEmpty()) {
-        if(!edit)
-            edit.reset(new GusdStageEdit);
-        edit->GetVariants().append(variants);
+        if(!edit) {
+            edit = GetVariantsEdit(variants);
+        } else {
+            MakeUnique(edit);
+            edit->GetVariants().append(variants);
+        }
+    }
+}
+
+
+void
+GusdStageEdit::MakeUnique(GusdStageEditPtr& edit)
+{
+    if(edit && edit->_shared)
+        edit.reset(new GusdStageEdit(*edit));
+}
+
+
+GusdStageEditPtr
+GusdStageEdit::GetVariantsEdit(const SdfPath& variants)
+{
+    _InternedEditMap& edits = _GetInternedEdits();
+    {
+        _InternedEditMap::const_accessor a;
+        if(edits.find(a, variants))
+            return a->second;
     }
+
+    GusdStageEditPtr edit(new GusdStageEdit);
+    edit->GetVariants().append(variants);
+    if(edits.size() >= _MAX_INTERNED_EDITS)
+        return edit;
+
+    edit->_shared = true;
+    _InternedEditMap::accessor a;
+    if(edits.insert(a, variants))
+        a->second = edit;
+    return a->second;
 }
 
 
@@ -32,6 +32,7 @@
 #include "pxr/usd/usd/stage.h"
 
 #include <UT/UT_Array.h>
+#include <UT/UT_Assert.h>
 #include <UT/UT_Error.h>
 #include <UT/UT_IntrusivePtr.h>
 
@@ -64,11 +65,37 @@ public:
     /// This covers the common case where a single parameter
     /// provides a prim path, which may include variant selections
     /// (Eg., as /foo{variant=sel}bar).
+    /// If \p edit is null, the returned edit is shared as described in
+    /// GetVariantsEdit(). If \p edit is a shared edit, it is replaced by a
+    /// copy before the variants are appended.
     static void
     GetPrimPathAndEditFromVariantsPath(const SdfPath& pathWithVariants,
                                        SdfPath& primPath,
                                        GusdStageEditPtr& edit);
 
+    /// Return an edit that applies the single variant selection path
+    /// \p variants. Edits are interned, so all callers asking for the same
+    /// variants (such as many packed prims with the same variant selections)
+    /// share one edit, and the stage cache can match them without comparing
+    /// their contents. The returned edit is marked as shared, and must not
+    /// be modified. Use MakeUnique() to get an edit that can be modified.
+    static GusdStageEditPtr
+    GetVariantsEdit(const SdfPath& variants);
+
+    /// If \p edit is shared, replace it with an unshared copy, so that it
+    /// can be modified without affecting the other users of the edit.
+    static void
+    MakeUnique(GusdStageEditPtr& edit);
+
+    GusdStageEdit() = default;
+
+    /// A copy of a shared edit is not shared.
+    GusdStageEdit(const GusdStageEdit& o)
+        : UT_IntrusiveRefCounter<GusdStageEdit>()
+        , _variants(o._variants)
+        , _layersToMute(o._layersToMute)
+        {}
+
     bool    Apply(const SdfLayerHandle& layer,
                           UT_ErrorSeverity sev=UT_ERROR_ABORT) const;
 
@@ -83,17 +110,28 @@ public:
                                     { return _variants; }
 
     UT_Array<SdfPath>&              GetVariants()
-                                    { return _variants; }
+                                    {
+                                        UT_ASSERT(!_shared);
+                                        return _variants;
+                                    }
 
     const std::vector<std::string>& GetLayersToMute() const
                                     { return _layersToMute; }
 
     std::vector<std::string>&       GetLayersToMute()
-                                    { return _layersToMute; }
+                                    {
+                                        UT_ASSERT(!_shared);
+                                        return _layersToMute;
+                                    }
+
+    /// Returns true if this edit is shared by GetVariantsEdit().
+    bool                            IsShared() const
+                                    { return _shared; }
 
 private:
     UT_Array<SdfPath>           _variants;
     std::vector<std::string>    _layersToMute;
+    bool                        _shared = false;
 };
 
 
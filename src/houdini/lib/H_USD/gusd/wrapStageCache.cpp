@@ -210,6 +210,51 @@ _ReloadStages(GusdStageCache& self, const list& paths)
 }
 
 
+list
+_GetStageStats(GusdStageCache& self)
+{
+    UT_Array<GusdStageCache::StageStats> stats;
+    GusdStageCacheWriter(self).GetStageStats(stats);
+
+    list statsList;
+    for(const auto& entry : stats) {
+        dict d;
+        d["stage"] = _StageRefToObj(entry.stage);
+        d["memorySize"] = entry.memorySize;
+        d["lastAccess"] = entry.lastAccess;
+        d["evictable"] = entry.evictable;
+        statsList.append(d);
+    }
+    return statsList;
+}
+
+
+list
+_GetMemoryReport(GusdStageCache& self)
+{
+    UT_Array<GusdStageCache::MemoryStats> stats;
+    GusdStageCacheWriter(self).GetMemoryReport(stats);
+
+    list statsList;
+    for(const auto& entry : stats) {
+        dict d;
+        d["category"] = entry.category.toStdString();
+        d["name"] = entry.name.toStdString();
+        d["memorySize"] = entry.memorySize;
+        d["entries"] = entry.entries;
+        statsList.append(d);
+    }
+    return statsList;
+}
+
+
+int64
+_EvictToBudget(GusdStageCache& self)
+{
+    return GusdStageCacheWriter(self).EvictToBudget();
+}
+
+
 void wrapGusdStageCache()
 {
     using This = GusdStageCache;
@@ -257,5 +302,15 @@ void wrapGusdStageCache()
         .def("FindStages", &_FindStages, (arg("paths")))
 
         .def("ReloadStages", &_ReloadStages, (arg("paths")))
+
+        .def("SetMemoryBudget", &This::SetMemoryBudget, (arg("bytes")))
+        .def("GetMemoryBudget", &This::GetMemoryBudget)
+        .def("GetMemoryUsage", &This::GetMemoryUsage)
+
+        .def("GetStageStats", &_GetStageStats)
+
+        .def("GetMemoryReport", &_GetMemoryReport)
+
+        .def("EvictToBudget", &_EvictToBudget)
         ;
 }